@@ -0,0 +1,83 @@
+#include "kinepredict/data_structures/Trie.h"
+#include "kinepredict/data_structures/AhoCorasick.h"
+#include "bench_common.h"
+#include <iostream>
+#include <iomanip>
+
+using namespace kinepredict;
+using namespace kinepredict::bench;
+
+namespace {
+
+std::string randomWord(std::mt19937_64& rng) {
+    std::string word;
+    size_t length = 3 + rng() % 6;
+    for (size_t j = 0; j < length; ++j) {
+        word.push_back(static_cast<char>('a' + rng() % 12));
+    }
+    return word;
+}
+
+// Baseline: probe the trie with every substring up to the longest keyword
+size_t naiveScan(const Trie& trie, std::string_view text, size_t maxLength) {
+    size_t matches = 0;
+    std::string candidate;
+    for (size_t start = 0; start < text.size(); ++start) {
+        candidate.clear();
+        for (size_t end = start; end < text.size() && end - start < maxLength; ++end) {
+            candidate.push_back(text[end]);
+            if (!trie.startsWith(candidate)) break;
+            matches += trie.search(candidate);
+        }
+    }
+    return matches;
+}
+
+} // namespace
+
+int main() {
+    std::cout << std::fixed << std::setprecision(2);
+
+    std::mt19937_64 rng(3);
+    Trie trie;
+    for (int i = 0; i < 50000; ++i) trie.insert(randomWord(rng));
+
+    // Space-separated headlines over the same alphabet
+    std::vector<std::string> owned;
+    size_t totalBytes = 0;
+    for (int i = 0; i < 20000; ++i) {
+        std::string document;
+        for (int w = 0; w < 12; ++w) document += randomWord(rng) + ' ';
+        totalBytes += document.size();
+        owned.push_back(std::move(document));
+    }
+    std::vector<std::string_view> documents(owned.begin(), owned.end());
+
+    Stopwatch timer;
+    AhoCorasick automaton(trie);
+    std::cout << "compile " << trie.size() << " keywords: " << timer.seconds() * 1e3 << " ms" << std::endl;
+
+    timer.reset();
+    size_t naiveMatches = 0;
+    for (auto document : documents) naiveMatches += naiveScan(trie, document, 8);
+    double naiveSeconds = timer.seconds();
+
+    timer.reset();
+    size_t automatonMatches = 0;
+    for (auto document : documents) {
+        automaton.scan(document, [&](const AhoCorasick::Match&) { ++automatonMatches; });
+    }
+    double scanSeconds = timer.seconds();
+
+    timer.reset();
+    auto batch = automaton.findAllBatch(documents, 4);
+    double batchSeconds = timer.seconds();
+    doNotOptimize(batch);
+
+    std::cout << "substring probes   " << std::setw(8) << totalBytes / naiveSeconds / 1e6 << " MB/s  ("
+              << naiveMatches << " matches)" << std::endl;
+    std::cout << "aho-corasick scan  " << std::setw(8) << totalBytes / scanSeconds / 1e6 << " MB/s  ("
+              << automatonMatches << " matches)" << std::endl;
+    std::cout << "batch, 4 threads   " << std::setw(8) << totalBytes / batchSeconds / 1e6 << " MB/s" << std::endl;
+    return 0;
+}
@@ -0,0 +1,97 @@
+#include "kinepredict/data_structures/BloomFilter.h"
+#include "bench_common.h"
+#include <iostream>
+#include <iomanip>
+
+using namespace kinepredict;
+using namespace kinepredict::bench;
+
+namespace {
+
+const char* layoutName(BloomFilter::Layout layout) {
+    return layout == BloomFilter::Layout::Blocked ? "blocked " : "standard";
+}
+
+void runLayout(size_t elements, BloomFilter::Layout layout,
+               const std::vector<std::string>& present,
+               const std::vector<std::string>& absent) {
+    BloomFilter bloom(elements, 0.01, layout);
+
+    Stopwatch timer;
+    for (const auto& key : present) bloom.add(key);
+    double addSeconds = timer.seconds();
+
+    timer.reset();
+    size_t hits = 0;
+    for (const auto& key : present) hits += bloom.contains(key);
+    double hitSeconds = timer.seconds();
+
+    timer.reset();
+    size_t falsePositives = 0;
+    for (const auto& key : absent) falsePositives += bloom.contains(key);
+    double missSeconds = timer.seconds();
+    doNotOptimize(hits);
+
+    double measured = static_cast<double>(falsePositives) / absent.size();
+    std::cout << "  " << layoutName(layout)
+              << "  add " << std::setw(7) << addSeconds * 1e9 / present.size() << " ns"
+              << "  hit " << std::setw(7) << hitSeconds * 1e9 / present.size() << " ns"
+              << "  miss " << std::setw(7) << missSeconds * 1e9 / absent.size() << " ns"
+              << "  FPR measured " << measured
+              << " / theoretical " << bloom.getFalsePositiveRate()
+              << "  (" << bloom.getMemoryUsage() / 1024 << " KiB)" << std::endl;
+}
+
+// Compare per-key and batched lookups on a filter far larger than L2
+void runBatch(BloomFilter::Layout layout, const std::vector<std::string>& keys) {
+    const size_t capacity = 100000000;  // ~120 MB of bits
+    BloomFilter bloom(capacity, 0.01, layout);
+    std::vector<std::string_view> views(keys.begin(), keys.end());
+    bloom.addBatch(views);
+
+    const size_t batchSize = 4096;
+    std::vector<std::vector<std::string_view>> batches;
+    for (size_t base = 0; base < views.size(); base += batchSize) {
+        size_t end = std::min(views.size(), base + batchSize);
+        batches.emplace_back(views.begin() + base, views.begin() + end);
+    }
+
+    Stopwatch timer;
+    size_t hits = 0;
+    for (const auto& key : keys) hits += bloom.contains(key);
+    double singleSeconds = timer.seconds();
+
+    timer.reset();
+    for (const auto& batch : batches) {
+        auto mask = bloom.containsBatch(batch);
+        doNotOptimize(mask.data());
+    }
+    double batchSeconds = timer.seconds();
+    doNotOptimize(hits);
+
+    std::cout << "  " << layoutName(layout)
+              << "  contains " << std::setw(10) << keys.size() / singleSeconds / 1e6 << " M/s"
+              << "  containsBatch " << std::setw(10) << keys.size() / batchSeconds / 1e6 << " M/s"
+              << "  (" << bloom.getMemoryUsage() / (1024 * 1024) << " MiB)" << std::endl;
+}
+
+} // namespace
+
+int main() {
+    std::cout << std::fixed << std::setprecision(4);
+    std::cout << "Bloom Filter layout benchmark (target FPR 0.01)" << std::endl;
+
+    for (size_t elements : {size_t(100000), size_t(4000000)}) {
+        auto present = makeKeys(elements, 1);
+        auto absent = makeKeys(elements, 2);
+        std::cout << "\n" << elements << " elements:" << std::endl;
+        runLayout(elements, BloomFilter::Layout::Standard, present, absent);
+        runLayout(elements, BloomFilter::Layout::Blocked, present, absent);
+    }
+
+    std::cout << "\nBatched lookups, 2M keys in batches of 4096:" << std::endl;
+    auto keys = makeKeys(2000000, 3);
+    runBatch(BloomFilter::Layout::Standard, keys);
+    runBatch(BloomFilter::Layout::Blocked, keys);
+    return 0;
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <chrono>
+#include <string>
+#include <vector>
+#include <random>
+#include <cstdint>
+
+namespace kinepredict::bench {
+
+/**
+ * @brief Wall-clock stopwatch for benchmark loops
+ */
+class Stopwatch {
+public:
+    Stopwatch() : start_(std::chrono::steady_clock::now()) {}
+
+    void reset() { start_ = std::chrono::steady_clock::now(); }
+
+    double seconds() const {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start_).count();
+    }
+
+private:
+    std::chrono::steady_clock::time_point start_;
+};
+
+/**
+ * @brief Keep the optimizer from discarding a benchmarked result
+ */
+template<typename T>
+inline void doNotOptimize(const T& value) {
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+/**
+ * @brief Generate deterministic pseudo-headline keys
+ * @param count Number of keys
+ * @param seed RNG seed (different seeds give disjoint-looking key sets)
+ */
+inline std::vector<std::string> makeKeys(size_t count, uint64_t seed) {
+    std::mt19937_64 rng(seed);
+    std::vector<std::string> keys;
+    keys.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        keys.push_back("headline-" + std::to_string(seed) + "-" + std::to_string(rng()));
+    }
+    return keys;
+}
+
+} // namespace kinepredict::bench
@@ -0,0 +1,63 @@
+#include "kinepredict/data_structures/ConcurrentBloomFilter.h"
+#include "kinepredict/data_structures/BloomFilter.h"
+#include "bench_common.h"
+#include <iostream>
+#include <iomanip>
+#include <thread>
+#include <mutex>
+
+using namespace kinepredict;
+using namespace kinepredict::bench;
+
+namespace {
+
+// Each thread dedups its slice of the stream: add, and count the repeats
+template<typename DedupFn>
+double runThreads(size_t numThreads, const std::vector<std::string>& keys, DedupFn dedup) {
+    std::vector<std::thread> threads;
+    Stopwatch timer;
+    for (size_t t = 0; t < numThreads; ++t) {
+        threads.emplace_back([&, t] {
+            size_t repeats = 0;
+            for (size_t i = t; i < keys.size(); i += numThreads) {
+                repeats += dedup(keys[i]);
+            }
+            doNotOptimize(repeats);
+        });
+    }
+    for (auto& thread : threads) thread.join();
+    return keys.size() / timer.seconds() / 1e6;
+}
+
+} // namespace
+
+int main() {
+    const size_t numKeys = 4000000;
+    auto keys = makeKeys(numKeys, 7);
+    unsigned hardware = std::max(1u, std::thread::hardware_concurrency());
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "Concurrent dedup throughput, " << numKeys << " keys ("
+              << hardware << " hardware threads)" << std::endl;
+
+    for (size_t threads : {1, 2, 4, 8, 16}) {
+        ConcurrentBloomFilter lockFree(numKeys, 0.01);
+        double lockFreeRate = runThreads(threads, keys, [&](const std::string& key) {
+            return lockFree.add(key);
+        });
+
+        BloomFilter locked(numKeys, 0.01);
+        std::mutex mutex;
+        double lockedRate = runThreads(threads, keys, [&](const std::string& key) {
+            std::lock_guard<std::mutex> lock(mutex);
+            bool seen = locked.contains(key);
+            locked.add(key);
+            return seen;
+        });
+
+        std::cout << "  " << std::setw(2) << threads << " threads"
+                  << "  lock-free " << std::setw(8) << lockFreeRate << " M ops/s"
+                  << "  mutex " << std::setw(8) << lockedRate << " M ops/s" << std::endl;
+    }
+    return 0;
+}
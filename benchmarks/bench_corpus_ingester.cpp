@@ -0,0 +1,116 @@
+#include "kinepredict/text_processing/CorpusIngester.h"
+#include "kinepredict/text_processing/TextProcessor.h"
+#include "kinepredict/data_structures/BloomFilter.h"
+#include "bench_common.h"
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <thread>
+#include <cstdio>
+#include <unistd.h>
+
+using namespace kinepredict;
+using namespace kinepredict::bench;
+
+namespace {
+
+// Word-like vocabulary: 3-10 letters, some capitalized
+std::vector<std::string> makeVocabulary(size_t count, uint64_t seed) {
+    std::mt19937_64 rng(seed);
+    std::vector<std::string> words;
+    words.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        std::string word(3 + rng() % 8, ' ');
+        for (char& c : word) c = static_cast<char>('a' + rng() % 26);
+        if (rng() % 4 == 0) word[0] = static_cast<char>(word[0] - 'a' + 'A');
+        words.push_back(std::move(word));
+    }
+    return words;
+}
+
+// Headlines drawn from the vocabulary; about a third repeat an earlier one
+size_t writeCorpus(const std::string& path, size_t count) {
+    auto vocabulary = makeVocabulary(20000, 11);
+    std::mt19937_64 rng(12);
+    std::vector<std::string> recent;
+    std::ofstream out(path, std::ios::binary);
+    size_t bytes = 0;
+    for (size_t i = 0; i < count; ++i) {
+        std::string headline;
+        if (!recent.empty() && rng() % 3 == 0) {
+            headline = recent[rng() % recent.size()];
+        } else {
+            size_t words = 6 + rng() % 8;
+            for (size_t w = 0; w < words; ++w) {
+                if (w) headline += ' ';
+                headline += vocabulary[rng() % vocabulary.size()];
+            }
+            if (recent.size() < 100000) recent.push_back(headline);
+            else recent[rng() % recent.size()] = headline;
+        }
+        headline += '\n';
+        out << headline;
+        bytes += headline.size();
+    }
+    return bytes;
+}
+
+void report(const char* label, const IngestStats& stats) {
+    std::cout << "  " << label << std::setw(8) << stats.megabytesPerSecond() << " MB/s  "
+              << std::setw(6) << stats.linesPerSecond() / 1e6 << " M lines/s  ("
+              << stats.uniqueLines << " unique)" << std::endl;
+}
+
+// Baseline: getline into std::string, then BloomFilter::add and Trie::insert
+IngestStats lineByLine(const std::string& path, size_t expected) {
+    Stopwatch timer;
+    BloomFilter dedup(expected, 0.01);
+    Trie keywords;
+    IngestStats stats;
+    std::ifstream in(path, std::ios::binary);
+    std::string line;
+    std::string buffer;
+    std::vector<std::string_view> tokens;
+    while (std::getline(in, line)) {
+        stats.bytes += line.size() + 1;
+        ++stats.lines;
+        TextProcessor::normalize(line, buffer, tokens);
+        if (dedup.contains(buffer)) {
+            ++stats.duplicateLines;
+            continue;
+        }
+        dedup.add(buffer);
+        ++stats.uniqueLines;
+        for (auto token : tokens) {
+            keywords.insert(std::string(token));
+        }
+    }
+    stats.seconds = timer.seconds();
+    return stats;
+}
+
+} // namespace
+
+int main() {
+    std::cout << std::fixed << std::setprecision(2);
+
+    const size_t count = 4000000;
+    std::string path = "/tmp/kinepredict_bench_corpus_" + std::to_string(::getpid()) + ".txt";
+    size_t bytes = writeCorpus(path, count);
+
+    std::cout << "Ingesting " << count << " headlines (" << bytes / 1e6 << " MB, "
+              << std::thread::hardware_concurrency() << " hardware threads)" << std::endl;
+
+    report("getline + add/insert ", lineByLine(path, count));
+    for (size_t threads : {1, 2, 4, 8}) {
+        ConcurrentBloomFilter dedup(count, 0.01);
+        Trie keywords;
+        CorpusIngester ingester(dedup, keywords, threads);
+        IngestStats stats = ingester.ingestFile(path);
+        std::string label = "mmap ingester " + std::to_string(threads) + " thr  ";
+        report(label.c_str(), stats);
+    }
+
+    std::remove(path.c_str());
+    return 0;
+}
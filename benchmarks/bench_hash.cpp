@@ -0,0 +1,87 @@
+#include "kinepredict/core/Hash.h"
+#include "kinepredict/data_structures/BloomFilter.h"
+#include "bench_common.h"
+#include <iostream>
+#include <iomanip>
+
+using namespace kinepredict;
+using namespace kinepredict::bench;
+
+namespace {
+
+// The byte-at-a-time pair BloomFilter used before hash128()
+uint64_t fnv1a(std::string_view element) {
+    uint64_t hash = 14695981039346656037ULL;
+    for (char c : element) {
+        hash ^= static_cast<uint64_t>(c);
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+uint64_t djb2(std::string_view element) {
+    uint64_t hash = 5381;
+    for (char c : element) {
+        hash = ((hash << 5) + hash) + static_cast<uint64_t>(c);
+    }
+    return hash;
+}
+
+std::vector<std::string> makeStrings(size_t count, size_t length) {
+    std::vector<std::string> strings;
+    strings.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        std::string s(length, 'a');
+        for (size_t j = 0; j < length; ++j) {
+            s[j] = static_cast<char>('a' + (i * 31 + j * 7) % 26);
+        }
+        strings.push_back(std::move(s));
+    }
+    return strings;
+}
+
+} // namespace
+
+int main() {
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "Key hashing throughput (both double-hashing halves per key)" << std::endl;
+
+    const size_t count = 200000;
+    const int rounds = 10;
+    for (size_t length : {8, 16, 40, 64, 128, 512}) {
+        auto keys = makeStrings(count, length);
+
+        Stopwatch timer;
+        uint64_t sink = 0;
+        for (int r = 0; r < rounds; ++r) {
+            for (const auto& key : keys) sink += fnv1a(key) ^ djb2(key);
+        }
+        double legacySeconds = timer.seconds();
+
+        timer.reset();
+        for (int r = 0; r < rounds; ++r) {
+            for (const auto& key : keys) {
+                Hash128 h = hash128(key);
+                sink += h.low ^ h.high;
+            }
+        }
+        double wideSeconds = timer.seconds();
+        doNotOptimize(sink);
+
+        double bytes = static_cast<double>(count) * length * rounds;
+        std::cout << "  " << std::setw(4) << length << " B"
+                  << "  FNV-1a+DJB2 " << std::setw(8) << bytes / legacySeconds / 1e9 << " GB/s"
+                  << "  hash128 " << std::setw(8) << bytes / wideSeconds / 1e9 << " GB/s"
+                  << "  (" << legacySeconds / wideSeconds << "x)" << std::endl;
+    }
+
+    // FPR quality on sequential keys, where weak hashes cluster
+    std::cout << "\nBloom Filter FPR with sequential keys (target 0.01):" << std::endl;
+    BloomFilter bloom(100000, 0.01);
+    for (int i = 0; i < 100000; ++i) bloom.add("item" + std::to_string(i));
+    int falsePositives = 0;
+    for (int i = 100000; i < 1100000; ++i) falsePositives += bloom.contains("item" + std::to_string(i));
+    std::cout << "  measured " << std::setprecision(4) << falsePositives / 1e6
+              << " / theoretical " << bloom.getFalsePositiveRate() << std::endl;
+    return 0;
+}
@@ -0,0 +1,88 @@
+#include "kinepredict/data_structures/LRUCache.h"
+#include "bench_common.h"
+#include <iostream>
+#include <iomanip>
+#include <algorithm>
+#include <cmath>
+#include <thread>
+
+using namespace kinepredict;
+using namespace kinepredict::bench;
+
+namespace {
+
+struct Prediction {
+    double score;
+    double lower;
+    double upper;
+};
+
+// Keys drawn from a Zipf(s) distribution over numKeys ranks
+std::vector<uint64_t> makeZipfKeys(size_t count, size_t numKeys, double s, uint64_t seed) {
+    std::vector<double> cdf(numKeys);
+    double sum = 0.0;
+    for (size_t rank = 0; rank < numKeys; ++rank) {
+        sum += 1.0 / std::pow(static_cast<double>(rank + 1), s);
+        cdf[rank] = sum;
+    }
+    std::mt19937_64 rng(seed);
+    std::uniform_real_distribution<double> uniform(0.0, sum);
+    std::vector<uint64_t> keys(count);
+    for (auto& key : keys) {
+        size_t rank = std::lower_bound(cdf.begin(), cdf.end(), uniform(rng)) - cdf.begin();
+        key = hashMix(rank);   // Stand-in for hash64 of the normalized headline
+    }
+    return keys;
+}
+
+// Read-through workload: get, and put on a miss
+void run(const char* label, size_t numShards, size_t numThreads, const std::vector<uint64_t>& keys,
+         size_t opsPerThread, size_t budget) {
+    LRUCache<Prediction> cache(budget, std::chrono::minutes(10), numShards);
+    std::vector<std::thread> threads;
+    Stopwatch timer;
+    for (size_t t = 0; t < numThreads; ++t) {
+        threads.emplace_back([&, t] {
+            size_t offset = t * (keys.size() / numThreads);
+            double checksum = 0.0;
+            for (size_t i = 0; i < opsPerThread; ++i) {
+                uint64_t key = keys[(offset + i) % keys.size()];
+                if (auto hit = cache.get(key)) {
+                    checksum += hit->score;
+                } else {
+                    cache.put(key, Prediction{0.5, 0.4, 0.6});
+                }
+            }
+            doNotOptimize(checksum);
+        });
+    }
+    for (auto& thread : threads) thread.join();
+    double seconds = timer.seconds();
+
+    auto stats = cache.stats();
+    std::cout << "  " << label << std::setw(3) << numThreads << " threads  " << std::setw(8)
+              << numThreads * opsPerThread / seconds / 1e6 << " M ops/s  hit rate "
+              << stats.hitRate() << "  evictions " << stats.evictions << std::endl;
+}
+
+} // namespace
+
+int main() {
+    std::cout << std::fixed << std::setprecision(2);
+
+    const size_t numKeys = 1000000;
+    const size_t opsPerThread = 500000;
+    // Room for about 10% of the key space
+    const size_t budget = numKeys / 10 * (sizeof(Prediction) + LRUCache<Prediction>::kEntryOverhead);
+
+    for (double s : {0.8, 0.99, 1.2}) {
+        auto keys = makeZipfKeys(4000000, numKeys, s, 1);
+        std::cout << "Zipf s=" << s << ", " << numKeys << " keys, budget " << budget / 1e6 << " MB ("
+                  << std::thread::hardware_concurrency() << " hardware threads)" << std::endl;
+        for (size_t threads : {1, 4, 16, 32}) {
+            run("64 shards ", 64, threads, keys, opsPerThread, budget);
+            run("1 shard   ", 1, threads, keys, opsPerThread, budget);
+        }
+    }
+    return 0;
+}
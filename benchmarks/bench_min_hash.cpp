@@ -0,0 +1,147 @@
+#include "kinepredict/text_processing/MinHash.h"
+#include "kinepredict/data_structures/LshIndex.h"
+#include "bench_common.h"
+#include <iostream>
+#include <iomanip>
+#include <algorithm>
+
+using namespace kinepredict;
+using namespace kinepredict::bench;
+
+namespace {
+
+std::vector<std::string> makeVocabulary(size_t count, std::mt19937_64& rng) {
+    std::vector<std::string> words;
+    for (size_t i = 0; i < count; ++i) {
+        std::string word(3 + rng() % 7, ' ');
+        for (char& c : word) c = static_cast<char>('a' + rng() % 26);
+        words.push_back(std::move(word));
+    }
+    return words;
+}
+
+std::string join(const std::vector<std::string>& words) {
+    std::string text;
+    for (const auto& word : words) {
+        if (!text.empty()) text += ' ';
+        text += word;
+    }
+    return text;
+}
+
+// Copy of a headline with a few word edits plus case/punctuation noise
+std::string makeVariant(std::vector<std::string> words, size_t edits,
+                        const std::vector<std::string>& vocabulary, std::mt19937_64& rng) {
+    for (size_t e = 0; e < edits; ++e) {
+        size_t at = rng() % words.size();
+        switch (rng() % 3) {
+            case 0: words[at] = vocabulary[rng() % vocabulary.size()]; break;
+            case 1: words.insert(words.begin() + at, vocabulary[rng() % vocabulary.size()]); break;
+            default: if (words.size() > 3) words.erase(words.begin() + at); break;
+        }
+    }
+    std::string text = join(words);
+    if (rng() % 2) text[0] = static_cast<char>(text[0] - 'a' + 'A');
+    if (rng() % 2) text += "!";
+    return text;
+}
+
+} // namespace
+
+int main() {
+    std::cout << std::fixed << std::setprecision(3);
+
+    std::mt19937_64 rng(7);
+    auto vocabulary = makeVocabulary(5000, rng);
+
+    // 20k originals, each with 4 variants of 0-3 edits
+    const size_t originals = 20000;
+    std::vector<std::vector<std::string>> bases;
+    std::vector<std::string> corpus;
+    for (size_t i = 0; i < originals; ++i) {
+        std::vector<std::string> words(8 + rng() % 6);
+        for (auto& word : words) word = vocabulary[rng() % vocabulary.size()];
+        bases.push_back(words);
+        corpus.push_back(join(words));
+        for (int v = 0; v < 4; ++v) {
+            corpus.push_back(makeVariant(words, rng() % 4, vocabulary, rng));
+        }
+    }
+    std::vector<std::string> queries;
+    for (size_t q = 0; q < 1000; ++q) {
+        queries.push_back(makeVariant(bases[rng() % originals], rng() % 4, vocabulary, rng));
+    }
+
+    MinHash minHash(128);
+    std::vector<std::vector<uint64_t>> corpusShingles(corpus.size());
+    for (size_t i = 0; i < corpus.size(); ++i) {
+        minHash.shingles(corpus[i], corpusShingles[i]);
+    }
+
+    Stopwatch timer;
+    std::vector<std::vector<uint32_t>> signatures(corpus.size());
+    for (size_t i = 0; i < corpus.size(); ++i) {
+        minHash.signature(corpus[i], signatures[i]);
+    }
+    double signatureSeconds = timer.seconds();
+    std::cout << "MinHash signatures (K=128): " << std::setw(8)
+              << corpus.size() / signatureSeconds / 1e6 << " M headlines/s" << std::endl;
+
+    std::cout << "Near-duplicate search over " << corpus.size() << " headlines, "
+              << queries.size() << " queries:" << std::endl;
+
+    for (double threshold : {0.5, 0.7, 0.9}) {
+        // Brute force: exact Jaccard against every stored shingle set
+        timer.reset();
+        std::vector<std::vector<LshIndex::Id>> truth(queries.size());
+        std::vector<uint64_t> queryShingles;
+        for (size_t q = 0; q < queries.size(); ++q) {
+            minHash.shingles(queries[q], queryShingles);
+            for (size_t i = 0; i < corpus.size(); ++i) {
+                if (MinHash::jaccard(queryShingles, corpusShingles[i]) >= threshold) {
+                    truth[q].push_back(static_cast<LshIndex::Id>(i));
+                }
+            }
+        }
+        double bruteSeconds = timer.seconds();
+
+        LshIndex index(minHash.numHashes(), threshold);
+        for (const auto& signature : signatures) index.insert(signature);
+
+        timer.reset();
+        std::vector<std::vector<LshIndex::Match>> found(queries.size());
+        std::vector<uint32_t> signature;
+        for (size_t q = 0; q < queries.size(); ++q) {
+            minHash.signature(queries[q], signature);
+            found[q] = index.query(signature);
+        }
+        double lshSeconds = timer.seconds();
+
+        // Recall of the banding step alone, before the signature filter
+        size_t candidateHits = 0;
+        std::vector<LshIndex::Id> candidates;
+        for (size_t q = 0; q < queries.size(); ++q) {
+            minHash.signature(queries[q], signature);
+            index.candidates(signature, candidates);
+            for (LshIndex::Id id : truth[q]) {
+                candidateHits += std::binary_search(candidates.begin(), candidates.end(), id);
+            }
+        }
+
+        size_t truePositives = 0, reported = 0, relevant = 0;
+        for (size_t q = 0; q < queries.size(); ++q) {
+            relevant += truth[q].size();
+            reported += found[q].size();
+            for (const auto& match : found[q]) {
+                truePositives += std::binary_search(truth[q].begin(), truth[q].end(), match.id);
+            }
+        }
+        std::cout << "  threshold " << threshold << " (b=" << index.numBands() << ", r=" << index.rowsPerBand()
+                  << ")  candidate recall " << static_cast<double>(candidateHits) / relevant
+                  << "  recall " << static_cast<double>(truePositives) / relevant
+                  << "  precision " << static_cast<double>(truePositives) / reported
+                  << "  brute force " << std::setw(8) << queries.size() / bruteSeconds << " q/s"
+                  << "  LSH " << std::setw(10) << queries.size() / lshSeconds << " q/s" << std::endl;
+    }
+    return 0;
+}
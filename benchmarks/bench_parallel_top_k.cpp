@@ -0,0 +1,74 @@
+#include "kinepredict/data_structures/ParallelTopK.h"
+#include "kinepredict/core/Hash.h"
+#include "bench_common.h"
+#include <iostream>
+#include <iomanip>
+#include <mutex>
+
+using namespace kinepredict;
+using namespace kinepredict::bench;
+
+namespace {
+
+struct Variant {
+    size_t id;
+    double score;
+    bool operator>(const Variant& other) const { return score > other.score; }
+};
+
+// Stand-in for the CTR model: a few rounds of hashing per headline
+double scoreHeadline(const std::string& headline) {
+    uint64_t h = hash64(headline);
+    for (int round = 0; round < 8; ++round) h = hashMix(h + round);
+    return static_cast<double>(h >> 11) / static_cast<double>(uint64_t(1) << 53);
+}
+
+} // namespace
+
+int main() {
+    std::cout << std::fixed << std::setprecision(2);
+
+    const size_t count = 2000000;
+    const size_t k = 100;
+    auto headlines = makeKeys(count, 12);
+
+    std::cout << "Best " << k << " of " << count << " scored variants ("
+              << std::thread::hardware_concurrency() << " hardware threads)" << std::endl;
+
+    double baseline = 0;
+    for (size_t threads : {1, 2, 4, 8, 16}) {
+        Stopwatch timer;
+        ParallelTopK<Variant, std::greater<Variant>> ranker(k, threads);
+        auto top = ranker.run(count, [&](size_t i) { return Variant{i, scoreHeadline(headlines[i])}; });
+        double parallelSeconds = timer.seconds();
+        doNotOptimize(top);
+        if (threads == 1) baseline = parallelSeconds;
+
+        // Baseline: every worker pushes into one PriorityQueue behind a mutex
+        timer.reset();
+        PriorityQueue<Variant, std::greater<Variant>> shared;
+        std::mutex mutex;
+        std::vector<std::thread> workers;
+        size_t perThread = (count + threads - 1) / threads;
+        for (size_t t = 0; t < threads; ++t) {
+            workers.emplace_back([&, t] {
+                size_t end = std::min(count, (t + 1) * perThread);
+                for (size_t i = t * perThread; i < end; ++i) {
+                    Variant variant{i, scoreHeadline(headlines[i])};
+                    std::lock_guard<std::mutex> lock(mutex);
+                    shared.push(variant);
+                }
+            });
+        }
+        for (auto& worker : workers) worker.join();
+        std::vector<Variant> lockedTop;
+        for (size_t i = 0; i < k; ++i) lockedTop.push_back(shared.pop());
+        double lockedSeconds = timer.seconds();
+        doNotOptimize(lockedTop);
+
+        std::cout << "  " << std::setw(2) << threads << " threads  per-thread TopK + merge "
+                  << std::setw(8) << parallelSeconds * 1e3 << " ms (x" << baseline / parallelSeconds
+                  << ")  locked heap " << std::setw(8) << lockedSeconds * 1e3 << " ms" << std::endl;
+    }
+    return 0;
+}
@@ -0,0 +1,203 @@
+#include "kinepredict/data_structures/PriorityQueue.h"
+#include "kinepredict/data_structures/KeyedPriorityQueue.h"
+#include "kinepredict/data_structures/TopK.h"
+#include "kinepredict/data_structures/IndexedPriorityQueue.h"
+#include "bench_common.h"
+#include <iostream>
+#include <iomanip>
+#include <queue>
+#include <algorithm>
+
+using namespace kinepredict;
+using namespace kinepredict::bench;
+
+namespace {
+
+struct ContentScore {
+    std::string content;
+    double score;
+    bool operator>(const ContentScore& other) const { return score > other.score; }
+    bool operator<(const ContentScore& other) const { return score < other.score; }
+};
+
+// The previous PriorityQueue: binary heap sifting with std::swap
+template<typename T, typename Compare>
+class SwapBinaryHeap {
+public:
+    void push(T element) {
+        heap_.push_back(std::move(element));
+        size_t index = heap_.size() - 1;
+        while (index > 0 && comp_(heap_[index], heap_[(index - 1) / 2])) {
+            std::swap(heap_[index], heap_[(index - 1) / 2]);
+            index = (index - 1) / 2;
+        }
+    }
+
+    T pop() {
+        T topElement = std::move(heap_[0]);
+        heap_[0] = std::move(heap_.back());
+        heap_.pop_back();
+        size_t index = 0;
+        while (true) {
+            size_t left = 2 * index + 1, right = left + 1, best = index;
+            if (left < heap_.size() && comp_(heap_[left], heap_[best])) best = left;
+            if (right < heap_.size() && comp_(heap_[right], heap_[best])) best = right;
+            if (best == index) break;
+            std::swap(heap_[index], heap_[best]);
+            index = best;
+        }
+        return topElement;
+    }
+
+    bool empty() const { return heap_.empty(); }
+
+private:
+    std::vector<T> heap_;
+    Compare comp_;
+};
+
+// Push every record, then pop them all in rank order
+template<typename Queue>
+double rankAll(const std::vector<ContentScore>& records) {
+    Queue queue;
+    Stopwatch timer;
+    for (const auto& record : records) queue.push(record);
+    double checksum = 0;
+    while (!queue.empty()) checksum += queue.pop().score;
+    doNotOptimize(checksum);
+    return timer.seconds();
+}
+
+double rankAllStd(const std::vector<ContentScore>& records) {
+    std::priority_queue<ContentScore, std::vector<ContentScore>, std::less<ContentScore>> queue;
+    Stopwatch timer;
+    for (const auto& record : records) queue.push(record);
+    double checksum = 0;
+    while (!queue.empty()) {
+        checksum += queue.top().score;
+        queue.pop();
+    }
+    doNotOptimize(checksum);
+    return timer.seconds();
+}
+
+template<size_t Arity>
+double rankAllKeyed(const std::vector<ContentScore>& records) {
+    KeyedPriorityQueue<double, std::string, std::greater<double>, Arity> queue;
+    Stopwatch timer;
+    for (const auto& record : records) queue.push(record.score, record.content);
+    double checksum = 0;
+    while (!queue.empty()) checksum += queue.pop().first;
+    doNotOptimize(checksum);
+    return timer.seconds();
+}
+
+} // namespace
+
+int main() {
+    std::cout << std::fixed << std::setprecision(2);
+
+    for (size_t count : {size_t(100000), size_t(2000000)}) {
+        // Headlines long enough to defeat the small-string buffer
+        auto headlines = makeKeys(count, 9);
+        std::mt19937_64 rng(10);
+        std::vector<ContentScore> records;
+        records.reserve(count);
+        for (auto& headline : headlines) {
+            records.push_back({headline + " | limited time offer", static_cast<double>(rng()) / rng.max()});
+        }
+
+        using Greater = std::greater<ContentScore>;
+        auto report = [&](const char* label, double seconds) {
+            std::cout << "  " << label << std::setw(8) << count / seconds / 1e6 << " M push+pop/s" << std::endl;
+        };
+
+        std::cout << count << " ContentScore records, push all then pop all:" << std::endl;
+        report("std::priority_queue        ", rankAllStd(records));
+        report("binary heap, swaps (before)", rankAll<SwapBinaryHeap<ContentScore, Greater>>(records));
+        report("PriorityQueue arity 2      ", rankAll<PriorityQueue<ContentScore, Greater, 2>>(records));
+        report("PriorityQueue arity 4      ", rankAll<PriorityQueue<ContentScore, Greater, 4>>(records));
+        report("PriorityQueue arity 8      ", rankAll<PriorityQueue<ContentScore, Greater, 8>>(records));
+        report("KeyedPriorityQueue arity 4 ", rankAllKeyed<4>(records));
+        report("KeyedPriorityQueue arity 8 ", rankAllKeyed<8>(records));
+
+        // Best 100 of N, the /batch case
+        const size_t k = 100;
+        std::cout << count << " records, best " << k << ":" << std::endl;
+
+        Stopwatch timer;
+        {
+            PriorityQueue<ContentScore, Greater> queue;
+            for (const auto& record : records) queue.push(record);
+            for (size_t i = 0; i < k; ++i) doNotOptimize(queue.pop());
+        }
+        double pushAllSeconds = timer.seconds();
+
+        // Heapify takes the vector by move; keep the copy out of the timing
+        std::vector<ContentScore> owned = records;
+        timer.reset();
+        {
+            PriorityQueue<ContentScore, Greater> queue(std::move(owned));
+            for (size_t i = 0; i < k; ++i) doNotOptimize(queue.pop());
+        }
+        double heapifySeconds = timer.seconds();
+
+        timer.reset();
+        {
+            TopK<ContentScore, Greater> best(k);
+            for (const auto& record : records) best.offer(record);
+            doNotOptimize(best.drainSorted());
+        }
+        double topKSeconds = timer.seconds();
+
+        std::cout << "  N pushes + K pops          " << std::setw(8) << pushAllSeconds * 1e3 << " ms" << std::endl;
+        std::cout << "  O(n) heapify + K pops      " << std::setw(8) << heapifySeconds * 1e3 << " ms" << std::endl;
+        std::cout << "  TopK offer + drainSorted   " << std::setw(8) << topKSeconds * 1e3 << " ms" << std::endl;
+    }
+
+    // Live re-scoring: CTR updates for 100k headlines, reading the leader
+    // after every 10 updates
+    {
+        const uint32_t headlines = 100000;
+        const size_t updates = 2000000;
+        std::mt19937_64 rng(11);
+        std::vector<std::pair<uint32_t, double>> feedback(updates);
+        for (auto& [handle, ctr] : feedback) {
+            handle = static_cast<uint32_t>(rng() % headlines);
+            ctr = static_cast<double>(rng()) / rng.max();
+        }
+
+        Stopwatch timer;
+        IndexedPriorityQueue<double, std::greater<double>> indexed;
+        for (uint32_t h = 0; h < headlines; ++h) indexed.push(h, 0.0);
+        for (size_t i = 0; i < updates; ++i) {
+            indexed.update(feedback[i].first, feedback[i].second);
+            if (i % 10 == 0) doNotOptimize(indexed.topHandle());
+        }
+        double indexedSeconds = timer.seconds();
+
+        // Baseline: push duplicates, skip stale entries when reading the top
+        timer.reset();
+        std::vector<double> current(headlines, 0.0);
+        PriorityQueue<std::pair<double, uint32_t>, std::greater<std::pair<double, uint32_t>>> lazy;
+        for (uint32_t h = 0; h < headlines; ++h) lazy.push({0.0, h});
+        size_t peak = 0;
+        for (size_t i = 0; i < updates; ++i) {
+            current[feedback[i].first] = feedback[i].second;
+            lazy.push({feedback[i].second, feedback[i].first});
+            if (i % 10 == 0) {
+                while (lazy.top().first != current[lazy.top().second]) lazy.pop();
+                doNotOptimize(lazy.top().second);
+            }
+            peak = std::max(peak, lazy.size());
+        }
+        double lazySeconds = timer.seconds();
+
+        std::cout << "Live re-scoring, " << headlines << " headlines, " << updates << " updates:" << std::endl;
+        std::cout << "  IndexedPriorityQueue update " << std::setw(8) << indexedSeconds * 1e3 << " ms  ("
+                  << indexed.size() << " entries)" << std::endl;
+        std::cout << "  duplicate push + lazy skip  " << std::setw(8) << lazySeconds * 1e3 << " ms  (peak "
+                  << peak << " entries)" << std::endl;
+    }
+    return 0;
+}
@@ -0,0 +1,118 @@
+#include "kinepredict/text_processing/SentimentLexicon.h"
+#include "kinepredict/text_processing/TextProcessor.h"
+#include "bench_common.h"
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <unordered_map>
+
+using namespace kinepredict;
+using namespace kinepredict::bench;
+
+namespace {
+
+const char* kFiller[] = {"summer", "shoes", "new", "collection", "today", "for", "the", "your",
+                         "store", "online", "week", "only", "with", "and", "our", "dresses"};
+const char* kScored[] = {"amazing", "great", "best", "free", "worst", "not", "love", "bad",
+                         "don't", "exclusive", "save", "boring"};
+
+void report(const char* name, size_t tokens, double seconds, double checksum) {
+    std::cout << "  " << std::left << std::setw(34) << name << std::right << std::setw(8)
+              << tokens / seconds / 1e6 << " M tokens/s  (checksum " << checksum << ")" << std::endl;
+}
+
+} // namespace
+
+int main() {
+    std::cout << std::fixed << std::setprecision(2);
+
+    // About one scored word per four tokens, as in ad copy
+    std::mt19937_64 rng(7);
+    std::string text;
+    for (size_t i = 0; i < 2000000; ++i) {
+        text += rng() % 4 == 0 ? kScored[rng() % 12] : kFiller[rng() % 16];
+        text += ' ';
+    }
+    std::string buffer;
+    std::vector<std::string_view> tokens;
+    TextProcessor::normalize(text, buffer, tokens);
+
+    const SentimentLexicon& lexicon = SentimentLexicon::builtin();
+    std::unordered_map<std::string, double> stringMap;
+    std::unordered_map<std::string_view, double> viewMap;
+    // The maps hold only the scored words the text uses (smaller than the
+    // lexicon, which favours them); scores are read back from the lexicon
+    for (const char* word : kScored) {
+        if (auto score = lexicon.find(word)) {
+            stringMap[word] = *score;
+            viewMap[word] = *score;
+        }
+    }
+    for (const char* word : {"awesome", "terrible", "hate", "wonderful", "awful", "perfect"}) {
+        stringMap[word] = *lexicon.find(word);
+        viewMap[word] = *lexicon.find(word);
+    }
+
+    std::cout << "Sentiment lookup over " << tokens.size() << " tokens (" << lexicon.size()
+              << " lexicon words)" << std::endl;
+
+    const int rounds = 10;
+    {
+        double total = 0.0;
+        Stopwatch timer;
+        for (int r = 0; r < rounds; ++r) {
+            for (std::string_view token : tokens) {
+                auto it = stringMap.find(std::string(token));
+                if (it != stringMap.end()) total += it->second;
+            }
+        }
+        doNotOptimize(total);
+        report("unordered_map<string> + copy", tokens.size() * rounds, timer.seconds(), total);
+    }
+    {
+        double total = 0.0;
+        Stopwatch timer;
+        for (int r = 0; r < rounds; ++r) {
+            for (std::string_view token : tokens) {
+                auto it = viewMap.find(token);
+                if (it != viewMap.end()) total += it->second;
+            }
+        }
+        doNotOptimize(total);
+        report("unordered_map<string_view>", tokens.size() * rounds, timer.seconds(), total);
+    }
+    {
+        double total = 0.0;
+        Stopwatch timer;
+        for (int r = 0; r < rounds; ++r) {
+            for (std::string_view token : tokens) {
+                if (auto score = lexicon.find(token)) total += *score;
+            }
+        }
+        doNotOptimize(total);
+        report("SentimentLexicon::find", tokens.size() * rounds, timer.seconds(), total);
+    }
+    {
+        double total = 0.0;
+        Stopwatch timer;
+        for (int r = 0; r < rounds; ++r) {
+            total += lexicon.score(tokens).score;
+        }
+        doNotOptimize(total);
+        report("SentimentLexicon::score (negation)", tokens.size() * rounds, timer.seconds(), total);
+    }
+
+    // Compile time for a large custom lexicon
+    std::vector<std::string> words;
+    std::vector<LexiconEntry> entries;
+    for (size_t i = 0; i < 1000000; ++i) {
+        words.push_back("w" + std::to_string(i));
+    }
+    for (size_t i = 0; i < words.size(); ++i) {
+        entries.push_back({words[i], static_cast<float>(i % 11) - 5});
+    }
+    Stopwatch timer;
+    SentimentLexicon large(entries);
+    std::cout << "  build " << large.size() << " words: " << timer.seconds() << " s" << std::endl;
+    return 0;
+}
@@ -0,0 +1,98 @@
+#include "kinepredict/data_structures/SnapshotTrie.h"
+#include "bench_common.h"
+#include <iostream>
+#include <iomanip>
+#include <thread>
+#include <shared_mutex>
+#include <atomic>
+#include <algorithm>
+
+using namespace kinepredict;
+using namespace kinepredict::bench;
+
+namespace {
+
+Trie buildDictionary(const std::vector<std::string>& words) {
+    Trie trie;
+    for (const auto& word : words) trie.insert(word);
+    return trie;
+}
+
+// Readers query for a fixed time while one writer keeps reloading
+template<typename SearchFn, typename ReloadFn>
+void run(const char* label, size_t numReaders, const std::vector<std::string>& queries,
+         SearchFn search, ReloadFn reload) {
+    std::atomic<bool> stop{false};
+    std::atomic<size_t> totalReads{0};
+    std::vector<double> worstLatency(numReaders, 0.0);
+    std::vector<std::thread> readers;
+    for (size_t t = 0; t < numReaders; ++t) {
+        readers.emplace_back([&, t] {
+            size_t reads = 0;
+            size_t found = 0;
+            for (size_t i = t; !stop.load(std::memory_order_relaxed); ++i, ++reads) {
+                // Time every 64th read to catch stalls behind a reload
+                if ((reads & 63) == 0) {
+                    Stopwatch latency;
+                    found += search(queries[i % queries.size()]);
+                    worstLatency[t] = std::max(worstLatency[t], latency.seconds());
+                } else {
+                    found += search(queries[i % queries.size()]);
+                }
+            }
+            doNotOptimize(found);
+            totalReads += reads;
+        });
+    }
+
+    size_t reloads = 0;
+    Stopwatch timer;
+    while (timer.seconds() < 2.0) {
+        reload();
+        ++reloads;
+    }
+    stop = true;
+    double seconds = timer.seconds();
+    for (auto& reader : readers) reader.join();
+
+    std::cout << "  " << label << std::setw(2) << numReaders << " readers  "
+              << std::setw(8) << totalReads / seconds / 1e6 << " M reads/s  worst sampled read "
+              << std::setw(9) << *std::max_element(worstLatency.begin(), worstLatency.end()) * 1e6
+              << " us  (" << reloads << " reloads)" << std::endl;
+}
+
+} // namespace
+
+int main() {
+    std::cout << std::fixed << std::setprecision(2);
+
+    auto words = makeKeys(200000, 5);
+    std::vector<std::string> queries(words.begin(), words.begin() + 100000);
+    auto misses = makeKeys(100000, 6);
+    queries.insert(queries.end(), misses.begin(), misses.end());
+
+    std::cout << "Read throughput during back-to-back reloads of " << words.size() << " keywords ("
+              << std::thread::hardware_concurrency() << " hardware threads)" << std::endl;
+
+    for (size_t readers : {1, 4, 8}) {
+        SnapshotTrie snapshot(buildDictionary(words));
+        run("snapshot swap  ", readers, queries,
+            [&](const std::string& key) { return snapshot.search(key); },
+            [&] { snapshot.publish(buildDictionary(words)); });
+
+        // Baseline: reader-writer lock, reload builds aside and swaps under the lock
+        Trie locked = buildDictionary(words);
+        std::shared_mutex mutex;
+        run("shared_mutex   ", readers, queries,
+            [&](const std::string& key) {
+                std::shared_lock<std::shared_mutex> lock(mutex);
+                return locked.search(key);
+            },
+            [&] {
+                Trie next = buildDictionary(words);
+                std::unique_lock<std::shared_mutex> lock(mutex);
+                locked = std::move(next);
+            });
+    }
+    return 0;
+}
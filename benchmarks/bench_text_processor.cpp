@@ -0,0 +1,119 @@
+#include "kinepredict/text_processing/TextProcessor.h"
+#include "bench_common.h"
+#include <iostream>
+#include <iomanip>
+#include <stdexcept>
+
+using namespace kinepredict;
+using namespace kinepredict::bench;
+
+namespace {
+
+std::vector<std::string> makeHeadlines(size_t count, bool multilingual, uint64_t seed) {
+    static const char* english[] = {"Limited", "TIME", "Offer:", "50%", "OFF", "Everything!", "You", "Won't",
+                                    "Believe", "These", "10", "Marketing", "Tips", "(Free)", "Download", "NOW"};
+    static const char* other[] = {"Café", "CRÈME", "—", "l'offre", "Скидки", "ДО", "Ελλάδα", "Łódź", "東京",
+                                  "«Soldes»", "Über", "Straße"};
+    std::mt19937_64 rng(seed);
+    std::vector<std::string> headlines;
+    headlines.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        std::string headline;
+        size_t words = 6 + rng() % 8;
+        for (size_t w = 0; w < words; ++w) {
+            if (w) headline += ' ';
+            headline += multilingual && rng() % 3 == 0 ? other[rng() % 12] : english[rng() % 16];
+        }
+        headlines.push_back(std::move(headline));
+    }
+    return headlines;
+}
+
+void run(const char* label, const std::vector<std::string>& headlines) {
+    size_t bytes = 0;
+    for (const auto& headline : headlines) bytes += headline.size();
+
+    // Both pipelines must produce the same tokens for the timings to compare
+    std::string buffer;
+    std::vector<std::string_view> tokens;
+    for (const auto& headline : headlines) {
+        std::string stripped = TextProcessor::removePunctuation(TextProcessor::toLowerCase(headline));
+        TextProcessor::normalize(headline, buffer, tokens);
+        if (tokens != TextProcessor::tokenize(stripped)) {
+            throw std::runtime_error("three-pass and fused tokens differ for: " + headline);
+        }
+    }
+
+    Stopwatch timer;
+    size_t tokenTotal = 0;
+    for (const auto& headline : headlines) {
+        std::string lowered = TextProcessor::toLowerCase(headline);
+        std::string stripped = TextProcessor::removePunctuation(lowered);
+        tokenTotal += TextProcessor::tokenize(stripped).size();
+    }
+    double threePassSeconds = timer.seconds();
+
+    timer.reset();
+    size_t fusedTotal = 0;
+    for (const auto& headline : headlines) {
+        TextProcessor::normalize(headline, buffer, tokens);
+        fusedTotal += tokens.size();
+    }
+    double fusedSeconds = timer.seconds();
+    doNotOptimize(tokenTotal + fusedTotal);
+
+    std::cout << label << " (" << headlines.size() << " headlines, " << tokenTotal << " tokens):" << std::endl;
+    std::cout << "  three passes    " << std::setw(8) << headlines.size() / threePassSeconds / 1e6 << " M headlines/s  "
+              << std::setw(8) << bytes / threePassSeconds / 1e6 << " MB/s" << std::endl;
+    std::cout << "  fused normalize " << std::setw(8) << headlines.size() / fusedSeconds / 1e6 << " M headlines/s  "
+              << std::setw(8) << bytes / fusedSeconds / 1e6 << " MB/s" << std::endl;
+}
+
+// 1..3-grams per headline: joined strings vs rolled hash IDs
+void runNGrams(const std::vector<std::string>& headlines) {
+    std::string buffer;
+    std::vector<std::string_view> tokens;
+    std::vector<std::vector<std::string_view>> tokenized;
+    std::vector<std::string> normalized;
+    normalized.reserve(headlines.size());
+    for (const auto& headline : headlines) {
+        TextProcessor::normalize(headline, buffer, tokens);
+        normalized.push_back(buffer);
+    }
+    for (const auto& text : normalized) {
+        tokenized.push_back(TextProcessor::tokenize(text));
+    }
+
+    Stopwatch timer;
+    size_t stringGrams = 0;
+    for (const auto& headlineTokens : tokenized) {
+        for (size_t n = 1; n <= 3; ++n) {
+            stringGrams += TextProcessor::extractNGrams(headlineTokens, n).size();
+        }
+    }
+    double stringSeconds = timer.seconds();
+
+    timer.reset();
+    std::vector<uint64_t> ids;
+    size_t hashedGrams = 0;
+    for (const auto& headlineTokens : tokenized) {
+        TextProcessor::hashNGrams(headlineTokens, 1, 3, ids);
+        hashedGrams += ids.size();
+    }
+    double hashedSeconds = timer.seconds();
+    doNotOptimize(stringGrams + hashedGrams);
+
+    std::cout << "1..3-grams (" << hashedGrams << " grams):" << std::endl;
+    std::cout << "  extractNGrams   " << std::setw(8) << stringGrams / stringSeconds / 1e6 << " M grams/s" << std::endl;
+    std::cout << "  hashNGrams      " << std::setw(8) << hashedGrams / hashedSeconds / 1e6 << " M grams/s" << std::endl;
+}
+
+} // namespace
+
+int main() {
+    std::cout << std::fixed << std::setprecision(2);
+    run("English", makeHeadlines(500000, false, 1));
+    run("Multilingual", makeHeadlines(500000, true, 2));
+    runNGrams(makeHeadlines(500000, false, 3));
+    return 0;
+}
@@ -0,0 +1,78 @@
+#include "kinepredict/text_processing/TfidfVectorizer.h"
+#include "bench_common.h"
+#include <iostream>
+#include <iomanip>
+#include <thread>
+
+using namespace kinepredict;
+using namespace kinepredict::bench;
+
+namespace {
+
+// Headlines over a skewed word-like vocabulary
+std::vector<std::string> makeHeadlines(size_t count, uint64_t seed) {
+    std::mt19937_64 rng(seed);
+    std::vector<std::string> vocabulary;
+    for (size_t i = 0; i < 50000; ++i) {
+        std::string word(3 + rng() % 7, ' ');
+        for (char& c : word) c = static_cast<char>('a' + rng() % 26);
+        vocabulary.push_back(std::move(word));
+    }
+    std::vector<std::string> headlines;
+    headlines.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        std::string headline;
+        size_t words = 6 + rng() % 8;
+        for (size_t w = 0; w < words; ++w) {
+            if (w) headline += ' ';
+            // Product of two uniforms: frequent words are much more common
+            size_t index = (rng() % vocabulary.size()) * (rng() % vocabulary.size()) / vocabulary.size();
+            headline += vocabulary[index];
+        }
+        headlines.push_back(std::move(headline));
+    }
+    return headlines;
+}
+
+} // namespace
+
+int main() {
+    std::cout << std::fixed << std::setprecision(2);
+
+    const size_t count = 2000000;
+    auto headlines = makeHeadlines(count, 1);
+    std::vector<std::string_view> documents(headlines.begin(), headlines.end());
+    std::cout << "TF-IDF over " << count << " headlines, 1-2 grams, min df 2 ("
+              << std::thread::hardware_concurrency() << " hardware threads)" << std::endl;
+
+    TfidfVectorizer vectorizer(2, 2);
+    for (size_t threads : {1, 2, 4, 8}) {
+        Stopwatch timer;
+        vectorizer.fit(documents, threads);
+        double seconds = timer.seconds();
+        std::cout << "  fit        " << threads << " threads  " << std::setw(8) << count / seconds / 1e6
+                  << " M headlines/s  (" << vectorizer.vocabularySize() << " terms)" << std::endl;
+    }
+
+    for (size_t threads : {1, 4}) {
+        Stopwatch timer;
+        SparseMatrix matrix = vectorizer.transform(documents, threads);
+        double seconds = timer.seconds();
+        std::cout << "  transform  " << threads << " threads  " << std::setw(8) << count / seconds / 1e6
+                  << " M headlines/s  (" << matrix.nonZeros() << " non-zeros)" << std::endl;
+    }
+
+    TfidfVectorizer::Scratch scratch;
+    std::vector<uint32_t> columns;
+    std::vector<float> values;
+    size_t total = 0;
+    Stopwatch timer;
+    for (size_t i = 0; i < 1000000; ++i) {
+        vectorizer.transform(documents[i], scratch, columns, values);
+        total += columns.size();
+    }
+    doNotOptimize(total);
+    std::cout << "  single-headline transform  " << std::setw(6) << timer.seconds() * 1e9 / 1000000
+              << " ns/headline" << std::endl;
+    return 0;
+}
@@ -0,0 +1,183 @@
+#include "kinepredict/data_structures/Trie.h"
+#include "kinepredict/data_structures/FrozenTrie.h"
+#include "bench_common.h"
+#include <iostream>
+#include <iomanip>
+#include <algorithm>
+#include <memory_resource>
+
+using namespace kinepredict;
+using namespace kinepredict::bench;
+
+namespace {
+
+// SEO-style keywords: lowercase words with shared stems
+std::vector<std::string> makeKeywords(size_t count, uint64_t seed) {
+    static const char* stems[] = {"market", "brand", "sale", "discount", "offer", "buy",
+                                  "content", "click", "free", "deal", "shop", "promo"};
+    std::mt19937_64 rng(seed);
+    std::vector<std::string> words;
+    words.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        std::string word = stems[rng() % 12];
+        size_t suffix = 2 + rng() % 8;
+        for (size_t j = 0; j < suffix; ++j) {
+            word.push_back(static_cast<char>('a' + rng() % 26));
+        }
+        words.push_back(std::move(word));
+    }
+    return words;
+}
+
+template<typename Dictionary>
+double lookupsPerSecond(const Dictionary& dictionary, const std::vector<std::string>& queries) {
+    Stopwatch timer;
+    size_t found = 0;
+    for (int round = 0; round < 5; ++round) {
+        for (const auto& query : queries) found += dictionary.search(query);
+    }
+    doNotOptimize(found);
+    return queries.size() * 5 / timer.seconds();
+}
+
+// Bulk load, then time the reload pause (clear) and the teardown
+void benchLoadAndClear(const char* label, Trie& trie, const std::vector<std::string>& words) {
+    Stopwatch timer;
+    for (const auto& word : words) trie.insert(word);
+    double loadSeconds = timer.seconds();
+
+    timer.reset();
+    trie.clear();
+    double clearSeconds = timer.seconds();
+
+    std::cout << "  " << label << "  load " << std::setw(8) << words.size() / loadSeconds / 1e6
+              << " M words/s  clear " << std::setw(8) << clearSeconds * 1e3 << " ms" << std::endl;
+}
+
+// Two-row Levenshtein distance for the linear-scan baseline
+size_t editDistance(const std::string& a, const std::string& b, std::vector<size_t>& row) {
+    row.resize(b.size() + 1);
+    for (size_t j = 0; j <= b.size(); ++j) row[j] = j;
+    for (size_t i = 1; i <= a.size(); ++i) {
+        size_t diagonal = row[0];
+        row[0] = i;
+        for (size_t j = 1; j <= b.size(); ++j) {
+            size_t above = row[j];
+            row[j] = std::min({row[j] + 1, row[j - 1] + 1, diagonal + (a[i - 1] != b[j - 1])});
+            diagonal = above;
+        }
+    }
+    return row[b.size()];
+}
+
+} // namespace
+
+int main() {
+    std::cout << std::fixed << std::setprecision(2);
+
+    for (size_t count : {size_t(100000), size_t(1000000)}) {
+        auto words = makeKeywords(count, 1);
+
+        Stopwatch timer;
+        Trie trie;
+        for (const auto& word : words) trie.insert(word);
+        double buildSeconds = timer.seconds();
+
+        timer.reset();
+        FrozenTrie frozen = trie.freeze();
+        double freezeSeconds = timer.seconds();
+
+        // Half hits, half misses
+        auto queries = makeKeywords(count / 2, 2);
+        queries.insert(queries.end(), words.begin(), words.begin() + count / 2);
+
+        std::cout << count << " keywords (" << trie.size() << " unique):" << std::endl;
+        std::cout << "  mutable trie  " << std::setw(8) << trie.getMemoryUsage() / 1048576.0 << " MiB  "
+                  << std::setw(8) << lookupsPerSecond(trie, queries) / 1e6 << " M lookups/s"
+                  << "  (build " << buildSeconds << " s)" << std::endl;
+        std::cout << "  frozen trie   " << std::setw(8) << frozen.getMemoryUsage() / 1048576.0 << " MiB  "
+                  << std::setw(8) << lookupsPerSecond(frozen, queries) / 1e6 << " M lookups/s"
+                  << "  (freeze " << freezeSeconds << " s)" << std::endl;
+    }
+
+    std::cout << "\nBulk load and reload pause, 1000000 keywords:" << std::endl;
+    auto words = makeKeywords(1000000, 3);
+    {
+        Trie trie;
+        benchLoadAndClear("slab (new/delete) ", trie, words);
+    }
+    {
+        std::pmr::monotonic_buffer_resource arena;
+        Trie trie(&arena);
+        benchLoadAndClear("slab (monotonic)  ", trie, words);
+    }
+
+    // Ten suggestions for a one-letter prefix over weighted keywords
+    std::cout << "\nTop-10 autocomplete, 1000000 weighted keywords:" << std::endl;
+    {
+        Trie trie;
+        std::mt19937_64 rng(4);
+        for (const auto& word : words) trie.insert(word, static_cast<float>(rng() % 1000000));
+
+        const int rounds = 20;
+        Stopwatch timer;
+        size_t collected = 0;
+        for (int round = 0; round < rounds; ++round) {
+            auto all = trie.getWordsWithPrefix("b");
+            std::partial_sort(all.begin(), all.begin() + std::min<size_t>(10, all.size()), all.end());
+            collected += all.size();
+        }
+        double collectSeconds = timer.seconds() / rounds;
+
+        timer.reset();
+        size_t suggested = 0;
+        for (int round = 0; round < rounds * 100; ++round) {
+            suggested += trie.topK("b", 10).size();
+        }
+        double topKSeconds = timer.seconds() / (rounds * 100);
+        doNotOptimize(suggested);
+
+        std::cout << "  collect + sort " << std::setw(10) << collectSeconds * 1e6 << " us  ("
+                  << collected / rounds << " words)" << std::endl;
+        std::cout << "  best-first topK" << std::setw(10) << topKSeconds * 1e6 << " us" << std::endl;
+    }
+
+    // Misspell existing keywords by one substitution and one transposition
+    std::cout << "\nFuzzy search, 1000000 keywords:" << std::endl;
+    {
+        Trie trie;
+        for (const auto& word : words) trie.insert(word);
+
+        std::vector<std::string> typos;
+        for (size_t i = 0; i < 20; ++i) {
+            std::string typo = words[i * 4999];
+            typo[typo.size() / 2] = 'q';
+            std::swap(typo[1], typo[2]);
+            typos.push_back(typo);
+        }
+
+        for (size_t maxEdits : {1, 2, 3}) {
+            Stopwatch timer;
+            size_t scanMatches = 0;
+            std::vector<size_t> row;
+            for (const auto& typo : typos) {
+                for (const auto& word : words) {
+                    size_t lengthGap = word.size() > typo.size() ? word.size() - typo.size() : typo.size() - word.size();
+                    if (lengthGap <= maxEdits && editDistance(typo, word, row) <= maxEdits) ++scanMatches;
+                }
+            }
+            double scanSeconds = timer.seconds() / typos.size();
+
+            timer.reset();
+            size_t trieMatches = 0;
+            for (const auto& typo : typos) trieMatches += trie.fuzzySearch(typo, maxEdits).size();
+            double trieSeconds = timer.seconds() / typos.size();
+
+            // The scan counts duplicate keywords; the trie reports each word once
+            std::cout << "  maxEdits " << maxEdits << "  linear scan " << std::setw(9) << scanSeconds * 1e3
+                      << " ms (" << scanMatches << ")  trie " << std::setw(7) << trieSeconds * 1e3
+                      << " ms (" << trieMatches << ")" << std::endl;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,179 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+namespace kinepredict {
+
+/**
+ * @brief 128-bit hash value, split into two independent 64-bit halves
+ * 
+ * The halves feed double hashing directly (BloomFilter probes use
+ * h1 + i * h2), so one pass over the key yields both.
+ */
+struct Hash128 {
+    uint64_t low;
+    uint64_t high;
+};
+
+namespace hash_detail {
+
+    constexpr uint64_t kSecret0 = 0xa0761d6478bd642fULL;
+    constexpr uint64_t kSecret1 = 0xe7037ed1a0b428dbULL;
+    constexpr uint64_t kSecret2 = 0x8ebc6af09c88c6e3ULL;
+    constexpr uint64_t kSecret3 = 0x589965cc75374cc3ULL;
+
+    inline uint64_t read64(const char* p) {
+        uint64_t value;
+        std::memcpy(&value, p, sizeof(value));
+        return value;
+    }
+
+    inline uint64_t read32(const char* p) {
+        uint32_t value;
+        std::memcpy(&value, p, sizeof(value));
+        return value;
+    }
+
+    inline uint64_t read3(const char* p, size_t len) {
+        return (uint64_t(static_cast<uint8_t>(p[0])) << 16) |
+               (uint64_t(static_cast<uint8_t>(p[len >> 1])) << 8) |
+               uint64_t(static_cast<uint8_t>(p[len - 1]));
+    }
+
+    // 64x64 -> 128 bit multiply, low and high halves written back
+    inline void multiply(uint64_t& a, uint64_t& b) {
+#if defined(__SIZEOF_INT128__)
+        __extension__ using uint128 = unsigned __int128;
+        uint128 product = static_cast<uint128>(a) * b;
+        a = static_cast<uint64_t>(product);
+        b = static_cast<uint64_t>(product >> 64);
+#else
+        uint64_t aHigh = a >> 32, aLow = static_cast<uint32_t>(a);
+        uint64_t bHigh = b >> 32, bLow = static_cast<uint32_t>(b);
+        uint64_t highHigh = aHigh * bHigh, highLow = aHigh * bLow;
+        uint64_t lowHigh = aLow * bHigh, lowLow = aLow * bLow;
+        uint64_t middle = (lowLow >> 32) + static_cast<uint32_t>(highLow) + static_cast<uint32_t>(lowHigh);
+        a = (middle << 32) | static_cast<uint32_t>(lowLow);
+        b = highHigh + (highLow >> 32) + (lowHigh >> 32) + (middle >> 32);
+#endif
+    }
+
+    inline uint64_t mix(uint64_t a, uint64_t b) {
+        multiply(a, b);
+        return a ^ b;
+    }
+
+    // Absorb the key into the (a, b) state, 48 bytes per round in three
+    // independent lanes so the multiplies overlap
+    inline void absorb(std::string_view data, uint64_t& seed, uint64_t& a, uint64_t& b) {
+        const char* p = data.data();
+        size_t len = data.size();
+        seed ^= mix(seed ^ kSecret0, kSecret1);
+
+        if (len <= 16) {
+            if (len >= 4) {
+                size_t shift = (len >> 3) << 2;
+                a = (read32(p) << 32) | read32(p + shift);
+                b = (read32(p + len - 4) << 32) | read32(p + len - 4 - shift);
+            } else if (len > 0) {
+                a = read3(p, len);
+                b = 0;
+            } else {
+                a = b = 0;
+            }
+            return;
+        }
+
+        size_t remaining = len;
+        if (remaining > 48) {
+            uint64_t lane1 = seed;
+            uint64_t lane2 = seed;
+            do {
+                seed = mix(read64(p) ^ kSecret1, read64(p + 8) ^ seed);
+                lane1 = mix(read64(p + 16) ^ kSecret2, read64(p + 24) ^ lane1);
+                lane2 = mix(read64(p + 32) ^ kSecret3, read64(p + 40) ^ lane2);
+                p += 48;
+                remaining -= 48;
+            } while (remaining > 48);
+            seed ^= lane1 ^ lane2;
+        }
+        while (remaining > 16) {
+            seed = mix(read64(p) ^ kSecret1, read64(p + 8) ^ seed);
+            p += 16;
+            remaining -= 16;
+        }
+
+        // Last 16 bytes, overlapping already absorbed ones if needed
+        a = read64(p + remaining - 16);
+        b = read64(p + remaining - 8);
+    }
+
+} // namespace hash_detail
+
+/**
+ * @brief Hash a byte string to 128 bits in one pass
+ * 
+ * wyhash-style: reads 8 bytes at a time and mixes with 64x64->128 bit
+ * multiplies, so it runs several times faster than byte-at-a-time FNV-1a
+ * or DJB2 and has full avalanche on both halves.
+ * 
+ * @param data Bytes to hash
+ * @param seed Optional seed for independent hash families
+ * @return Both 64-bit halves
+ */
+inline Hash128 hash128(std::string_view data, uint64_t seed = 0) {
+    using namespace hash_detail;
+    uint64_t a, b;
+    absorb(data, seed, a, b);
+
+    a ^= kSecret1;
+    b ^= seed;
+    multiply(a, b);
+    uint64_t len = data.size();
+    return {mix(a ^ kSecret0 ^ len, b ^ kSecret1),
+            mix(a ^ kSecret2, b ^ kSecret3 ^ len)};
+}
+
+/**
+ * @brief Hash a byte string to 64 bits
+ * @param data Bytes to hash
+ * @param seed Optional seed
+ * @return Same value as hash128(data, seed).low
+ */
+inline uint64_t hash64(std::string_view data, uint64_t seed = 0) {
+    using namespace hash_detail;
+    uint64_t a, b;
+    absorb(data, seed, a, b);
+
+    a ^= kSecret1;
+    b ^= seed;
+    multiply(a, b);
+    return mix(a ^ kSecret0 ^ data.size(), b ^ kSecret1);
+}
+
+/**
+ * @brief Scramble a 64-bit integer key (e.g. an id or precomputed hash)
+ * @param value Key to scramble
+ * @return Well-distributed 64-bit hash
+ */
+inline uint64_t hashMix(uint64_t value) {
+    return hash_detail::mix(value ^ hash_detail::kSecret0, hash_detail::kSecret1);
+}
+
+/**
+ * @brief Fold a value into a running hash (order-sensitive)
+ * 
+ * Used to build n-gram and cache-key hashes from per-token hashes
+ * without concatenating strings.
+ * 
+ * @param seed Running hash
+ * @param value Hash to fold in
+ * @return Combined hash
+ */
+inline uint64_t hashCombine(uint64_t seed, uint64_t value) {
+    return hash_detail::mix(seed ^ hash_detail::kSecret2, value ^ hash_detail::kSecret3);
+}
+
+} // namespace kinepredict
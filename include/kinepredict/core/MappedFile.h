@@ -0,0 +1,67 @@
+#pragma once
+
+#include <string>
+#include <cstddef>
+
+namespace kinepredict {
+
+/**
+ * @brief Read-only memory-mapped file (RAII)
+ * 
+ * Maps the whole file so callers can read it in place without copying.
+ * Pages are loaded on demand by the OS, so files larger than RAM work.
+ */
+class MappedFile {
+public:
+    /**
+     * @brief Map a file read-only
+     * @param path File to map
+     * @throws std::runtime_error if the file can't be opened or mapped
+     */
+    explicit MappedFile(const std::string& path);
+    ~MappedFile();
+    
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+    
+    /**
+     * @brief Get start of the mapping (page aligned, nullptr for empty files)
+     * @return Pointer to the file contents
+     */
+    const char* data() const { return data_; }
+    
+    /**
+     * @brief Get file size in bytes
+     * @return Size of the mapping
+     */
+    size_t size() const { return size_; }
+    
+    /**
+     * @brief Hint that the file will be read front to back
+     * 
+     * Enables aggressive read-ahead. Purely advisory; failures are ignored.
+     */
+    void adviseSequential() const;
+    
+    /**
+     * @brief Drop the resident pages of a range that is no longer needed
+     * 
+     * Lets a single pass over a file larger than RAM run without evicting
+     * everything else. Only whole pages inside the range are released;
+     * reading them again later faults them back in from the file.
+     * 
+     * @param offset Start of the range in bytes
+     * @param length Length of the range in bytes
+     */
+    void release(size_t offset, size_t length) const;
+
+private:
+    const char* data_;
+    size_t size_;
+    
+    void unmap();
+};
+
+} // namespace kinepredict
@@ -0,0 +1,120 @@
+#pragma once
+
+#include <string_view>
+#include <vector>
+#include <cstdint>
+
+namespace kinepredict {
+
+class Trie;
+
+/**
+ * @brief Aho-Corasick multi-pattern scanner compiled from a Trie
+ * 
+ * Used for:
+ * - Finding every tracked keyword in a headline in one pass
+ * - Matches that span token boundaries ("buy now", "50% off")
+ * 
+ * The trie's nodes become automaton states (renumbered breadth-first
+ * into flat arrays) with failure links, which jump to the longest proper
+ * suffix that is also a dictionary prefix, and output links, which
+ * point to the nearest dictionary word on that failure chain. Matching is
+ * byte-exact; normalize text and keywords the same way beforehand.
+ * 
+ * The automaton is an immutable copy, so it can be shared by any number
+ * of scanning threads and outlives changes to the source trie.
+ * 
+ * Time Complexity:
+ * - Build: O(N * A) for N trie nodes and alphabet size A
+ * - Scan: O(n + z) for text length n and z matches
+ */
+class AhoCorasick {
+public:
+    struct Match {
+        size_t position;   // Byte offset of the first character
+        size_t length;     // Keyword length in bytes
+        
+        bool operator==(const Match& other) const {
+            return position == other.position && length == other.length;
+        }
+    };
+    
+    /**
+     * @brief Compile the words of a trie into an automaton
+     * @param dictionary Keywords to search for
+     */
+    explicit AhoCorasick(const Trie& dictionary);
+    
+    /**
+     * @brief Report every keyword occurrence, including overlapping ones
+     * @param text Text to scan
+     * @param onMatch Called with each Match in order of end position
+     */
+    template<typename Callback>
+    void scan(std::string_view text, Callback&& onMatch) const {
+        uint32_t state = kRoot;
+        for (size_t i = 0; i < text.size(); ++i) {
+            state = next(state, static_cast<unsigned char>(text[i]));
+            for (uint32_t hit = terminal_[state] ? state : output_[state]; hit != kNone; hit = output_[hit]) {
+                onMatch(Match{i + 1 - depth_[hit], depth_[hit]});
+            }
+        }
+    }
+    
+    /**
+     * @brief Find all keyword occurrences in a text
+     * @param text Text to scan
+     * @return Matches in order of end position
+     */
+    std::vector<Match> findAll(std::string_view text) const;
+    
+    /**
+     * @brief Scan many documents against this automaton
+     * @param documents Texts to scan
+     * @param numThreads Worker threads (documents are split into contiguous ranges)
+     * @return Matches per document, same order as documents
+     */
+    std::vector<std::vector<Match>> findAllBatch(const std::vector<std::string_view>& documents,
+                                                 size_t numThreads = 1) const;
+    
+    /**
+     * @brief Check whether a text contains any keyword
+     * @param text Text to scan
+     * @return true at the first match
+     */
+    bool containsAny(std::string_view text) const;
+    
+    /**
+     * @brief Get number of keywords
+     * @return Pattern count
+     */
+    size_t patternCount() const { return patternCount_; }
+
+private:
+    static constexpr uint32_t kRoot = 0;
+    static constexpr uint32_t kNone = UINT32_MAX;
+
+    // Per-state arrays, states numbered breadth-first
+    std::vector<uint32_t> edgeBegin_;     // Edges of state s: [edgeBegin_[s], edgeBegin_[s + 1])
+    std::vector<unsigned char> labels_;   // Sorted within each state
+    std::vector<uint32_t> targets_;
+    std::vector<uint32_t> fail_;
+    std::vector<uint32_t> output_;        // Nearest terminal state on the failure chain
+    std::vector<uint32_t> depth_;
+    std::vector<bool> terminal_;
+    uint32_t rootNext_[256];              // Dense transitions out of the root
+    size_t patternCount_;
+    
+    uint32_t child(uint32_t state, unsigned char c) const;
+    
+    uint32_t next(uint32_t state, unsigned char c) const {
+        while (state != kRoot) {
+            uint32_t target = child(state, c);
+            if (target != kNone) return target;
+            state = fail_[state];
+        }
+        return rootNext_[c];
+    }
+};
+
+} // namespace kinepredict
@@ -2,11 +2,15 @@
 
 #include <vector>
 #include <string>
+#include <string_view>
 #include <cstdint>
 #include <functional>
+#include <iosfwd>
 
 namespace kinepredict {
 
+class BloomFilterView;
+
 /**
  * @brief Bloom Filter for fast duplicate detection with space efficiency
  * 
@@ -17,17 +21,41 @@ namespace kinepredict {
  * 
  * Trade-off: Space efficient but allows false positives (no false negatives)
  * 
+ * Two bit layouts are available, chosen at construction time:
+ * - Standard: the k probes are spread over the whole bit array
+ *   (up to k cache misses per lookup)
+ * - Blocked: all k probes for a key land in one 64-byte block, so a
+ *   lookup costs one cache miss and one SIMD compare, at the price of a
+ *   slightly higher false positive rate for the same memory
+ * 
+ * Filters built with the same parameters can be merged (union) or
+ * intersected word by word, and serialized to a compact binary format
+ * that BloomFilterView can query in place from a memory-mapped file.
+ * 
  * Time Complexity: O(k) where k is number of hash functions
  * Space Complexity: O(m) where m is bit array size
  */
 class BloomFilter {
 public:
+    enum class Layout {
+        Standard,
+        Blocked
+    };
+
     /**
      * @brief Construct Bloom Filter
      * @param expectedElements Expected number of elements
      * @param falsePositiveRate Desired false positive rate (0.0 to 1.0)
+     * @param layout Bit layout (Standard or cache-line Blocked)
+     */
+    BloomFilter(size_t expectedElements, double falsePositiveRate = 0.01,
+                Layout layout = Layout::Standard);
+    
+    /**
+     * @brief Construct a mutable copy of a serialized filter
+     * @param view The filter to copy
      */
-    BloomFilter(size_t expectedElements, double falsePositiveRate = 0.01);
+    explicit BloomFilter(const BloomFilterView& view);
     
     /**
      * @brief Add element to filter
@@ -42,6 +70,46 @@ public:
      */
     bool contains(const std::string& element) const;
     
+    /**
+     * @brief Add an element identified by a precomputed 64-bit hash
+     * 
+     * For keys that are already hashed, such as TextProcessor::hashNGrams
+     * IDs. The probe hashes are derived with hashMix, so even sequential IDs
+     * get the filter's usual false positive rate. IDs live in their own key
+     * space: addHashed(hash64(s)) does not imply contains(s).
+     * 
+     * @param id The element's hash
+     */
+    void addHashed(uint64_t id);
+    
+    /**
+     * @brief Check an element added with addHashed
+     * @param id The element's hash
+     * @return true if possibly in set, false if definitely not
+     */
+    bool containsHashed(uint64_t id) const;
+    
+    /**
+     * @brief Add a batch of elements
+     * 
+     * Hashes a chunk of keys first, prefetches their target words, and only
+     * then touches the bit array, so cache misses overlap across keys.
+     * Keys are applied in order, so a repeat later in the same batch is
+     * reported as present.
+     * 
+     * @param elements The strings to add
+     * @return Bitmask (bit i of word i/64) of keys that were possibly
+     *         present before being added
+     */
+    std::vector<uint64_t> addBatch(const std::vector<std::string_view>& elements);
+    
+    /**
+     * @brief Check a batch of elements
+     * @param elements The strings to check
+     * @return Bitmask (bit i of word i/64) set for keys possibly in set
+     */
+    std::vector<uint64_t> containsBatch(const std::vector<std::string_view>& elements) const;
+    
     /**
      * @brief Clear all data
      */
@@ -49,6 +117,10 @@ public:
     
     /**
      * @brief Get false positive probability
+     * 
+     * For the Blocked layout this accounts for the uneven load across
+     * blocks, so it is slightly higher than the Standard estimate.
+     * 
      * @return Current estimated false positive rate
      */
     double getFalsePositiveRate() const;
@@ -59,20 +131,119 @@ public:
      */
     size_t getMemoryUsage() const;
 
+    /**
+     * @brief Check whether another filter has the same layout and parameters
+     * @param other The filter to compare with
+     * @return true if merge() and intersect() accept it
+     */
+    bool isCompatible(const BloomFilterView& other) const;
+    
+    /**
+     * @brief Union another filter into this one
+     * 
+     * The element count becomes an estimate derived from the bit population.
+     * 
+     * @param other A compatible filter
+     * @throws std::invalid_argument if the filters are not compatible
+     */
+    void merge(const BloomFilterView& other);
+    void merge(const BloomFilter& other);
+    
+    /**
+     * @brief Intersect this filter with another one
+     * 
+     * Keeps only bits set in both. Elements added to both filters are still
+     * found; the result may report more false positives than a filter built
+     * from the intersection directly.
+     * 
+     * @param other A compatible filter
+     * @throws std::invalid_argument if the filters are not compatible
+     */
+    void intersect(const BloomFilterView& other);
+    void intersect(const BloomFilter& other);
+    
+    /**
+     * @brief Write the filter in the binary shard format
+     * 
+     * Layout: a 64-byte header (magic "KPBF", version, layout, k, m, block
+     * count, element count) followed by the raw 64-bit words in host
+     * (little-endian) byte order.
+     * 
+     * @param out Destination stream
+     */
+    void serialize(std::ostream& out) const;
+    
+    /**
+     * @brief Read a filter written by serialize()
+     * @param in Source stream
+     * @return The filter
+     * @throws std::runtime_error on a truncated or malformed shard
+     */
+    static BloomFilter deserialize(std::istream& in);
+    
+    /**
+     * @brief Get a read-only view over this filter's bits
+     * @return View valid until this filter is modified or destroyed
+     */
+    BloomFilterView view() const;
+
+    /**
+     * @brief Get number of elements added since construction or clear()
+     * @return Element count
+     */
+    size_t getElementCount() const { return elementCount_; }
+
+    /**
+     * @brief Get the bit layout chosen at construction
+     * @return Standard or Blocked
+     */
+    Layout getLayout() const { return layout_; }
+
 private:
-    std::vector<bool> bitArray_;
+    static constexpr size_t kBitsPerBlock = 512;    // One 64-byte cache line
+    static constexpr size_t kWordsPerBlock = kBitsPerBlock / 64;
+    static constexpr size_t kBatchChunk = 64;      // Keys hashed per prefetch round
+    static constexpr size_t kMaxHashFunctions = 256;   // Also the limit shard headers accept
+
+    struct alignas(64) Block {
+        uint64_t words[kWordsPerBlock];
+    };
+
+    std::vector<Block> blocks_;
+    Layout layout_;
     size_t numHashFunctions_;
     size_t bitArraySize_;
+    size_t numBlocks_;
     size_t elementCount_;
     
-    // Hash functions
-    uint64_t hash1(const std::string& element) const;
-    uint64_t hash2(const std::string& element) const;
-    uint64_t nthHash(size_t n, uint64_t hash1, uint64_t hash2) const;
+    uint64_t* words() { return blocks_.front().words; }
+    const uint64_t* words() const { return blocks_.front().words; }
+
+    // Build the in-block probe mask of a key (Blocked layout)
+    static void blockMask(size_t numHashFunctions, uint64_t h1, uint64_t h2, uint64_t* mask);
+    static bool blockContains(const uint64_t* block, const uint64_t* mask);
+    static bool testBits(const uint64_t* bits, Layout layout, size_t numHashFunctions,
+                         size_t bitArraySize, size_t numBlocks, uint64_t h1, uint64_t h2);
+    
+    // Element count implied by the number of set bits
+    size_t estimateElementCount() const;
+
+    // Probe helpers shared by the single-key and batch paths
+    bool testAndSet(uint64_t h1, uint64_t h2);
+    bool test(uint64_t h1, uint64_t h2) const;
+    void prefetch(uint64_t h1, uint64_t h2) const;
+
+    // Double hashing over the two halves of hash128()
+    static uint64_t nthHash(size_t n, uint64_t hash1, uint64_t hash2);
     
     // Calculate optimal parameters
     static size_t calculateBitArraySize(size_t n, double p);
     static size_t calculateNumHashFunctions(size_t m, size_t n);
+
+    // Shares the hashing and sizing scheme
+    friend class ConcurrentBloomFilter;
+    friend class SlidingWindowBloomFilter;
+    friend class BloomFilterView;
 };
 
 } // namespace kinepredict
@@ -0,0 +1,97 @@
+#pragma once
+
+#include "kinepredict/data_structures/BloomFilter.h"
+#include <memory>
+#include <string>
+#include <string_view>
+#include <cstdint>
+
+namespace kinepredict {
+
+class MappedFile;
+
+/**
+ * @brief Read-only Bloom Filter over borrowed or memory-mapped bits
+ * 
+ * Queries a filter in the binary shard format written by
+ * BloomFilter::serialize() without copying the bit array, e.g. a shard
+ * received from another ingest node. Views can be merged into a mutable
+ * BloomFilter with BloomFilter::merge().
+ * 
+ * Time Complexity: O(k) lookup, O(1) open
+ */
+class BloomFilterView {
+public:
+    /**
+     * @brief View serialized bytes in place
+     * @param data Start of the shard (must be 8-byte aligned and outlive the view)
+     * @param size Size of the shard in bytes
+     * @throws std::runtime_error on a truncated or malformed shard
+     */
+    BloomFilterView(const void* data, size_t size);
+    
+    /**
+     * @brief Memory-map a shard file and view it
+     * @param path Shard written by BloomFilter::serialize()
+     * @return View that keeps the mapping alive
+     * @throws std::runtime_error if the file can't be mapped or is malformed
+     */
+    static BloomFilterView open(const std::string& path);
+    
+    /**
+     * @brief Check if element might be in set
+     * @param element The string to check
+     * @return true if possibly in set, false if definitely not
+     */
+    bool contains(std::string_view element) const;
+    
+    BloomFilter::Layout getLayout() const { return layout_; }
+    size_t getNumHashFunctions() const { return numHashFunctions_; }
+    size_t getBitArraySize() const { return bitArraySize_; }
+    size_t getElementCount() const { return elementCount_; }
+    
+    /**
+     * @brief Get the raw bit array
+     * @return Pointer to getWordCount() 64-bit words
+     */
+    const uint64_t* getWords() const { return words_; }
+    size_t getWordCount() const { return numBlocks_ * kWordsPerBlock; }
+
+private:
+    static constexpr size_t kWordsPerBlock = 8;
+    static constexpr char kMagic[4] = {'K', 'P', 'B', 'F'};
+    static constexpr uint32_t kVersion = 2;     // 2: hash128 key hashing
+
+    // On-disk header, padded to one cache line so the words stay aligned
+    struct Header {
+        char magic[4];
+        uint32_t version;
+        uint32_t layout;
+        uint32_t numHashFunctions;
+        uint64_t bitArraySize;
+        uint64_t numBlocks;
+        uint64_t elementCount;
+        uint8_t reserved[24];
+    };
+    static_assert(sizeof(Header) == 64, "Shard header must be one cache line");
+
+    // Throws std::runtime_error unless the header describes a shard this
+    // build could have written; checked before anything is sized from it
+    static void validate(const Header& header);
+
+    std::shared_ptr<const MappedFile> file_;
+    const uint64_t* words_;
+    BloomFilter::Layout layout_;
+    size_t numHashFunctions_;
+    size_t bitArraySize_;
+    size_t numBlocks_;
+    size_t elementCount_;
+    
+    // View over a live BloomFilter (see BloomFilter::view())
+    BloomFilterView(const uint64_t* words, BloomFilter::Layout layout, size_t numHashFunctions,
+                    size_t bitArraySize, size_t numBlocks, size_t elementCount);
+    
+    friend class BloomFilter;
+};
+
+} // namespace kinepredict
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <cstdint>
+
+namespace kinepredict {
+
+/**
+ * @brief Lock-free Bloom Filter shared by concurrent ingestion threads
+ * 
+ * Same hashing and sizing as BloomFilter, but the bits live in atomic
+ * 64-bit words: inserts use relaxed fetch_or and lookups use relaxed
+ * loads, so any number of threads may call add() and contains() at once
+ * without a mutex.
+ * 
+ * A contains() racing with the add() of the same key may return either
+ * answer; once add() has returned (and happens-before the lookup), the
+ * key is always reported as present.
+ * 
+ * The element count is kept in cache-line padded shards so that inserting
+ * threads don't contend on one counter. getElementCount() sums the
+ * shards and is only approximate while inserts are in flight.
+ * 
+ * Time Complexity: O(k) where k is number of hash functions
+ * Space Complexity: O(m) where m is bit array size
+ */
+class ConcurrentBloomFilter {
+public:
+    /**
+     * @brief Construct Concurrent Bloom Filter
+     * @param expectedElements Expected number of elements
+     * @param falsePositiveRate Desired false positive rate (0.0 to 1.0)
+     */
+    ConcurrentBloomFilter(size_t expectedElements, double falsePositiveRate = 0.01);
+    
+    ConcurrentBloomFilter(const ConcurrentBloomFilter&) = delete;
+    ConcurrentBloomFilter& operator=(const ConcurrentBloomFilter&) = delete;
+    
+    /**
+     * @brief Add element to filter (thread-safe)
+     * @param element The string to add
+     * @return true if the element was possibly present before this call
+     */
+    bool add(std::string_view element);
+    
+    /**
+     * @brief Check if element might be in set (thread-safe)
+     * @param element The string to check
+     * @return true if possibly in set, false if definitely not
+     */
+    bool contains(std::string_view element) const;
+    
+    /**
+     * @brief Clear all data
+     * 
+     * Not linearizable with concurrent add(); call it between ingestion runs.
+     */
+    void clear();
+    
+    /**
+     * @brief Get approximate number of added elements
+     * @return Sum of the per-shard counters
+     */
+    size_t getElementCount() const;
+    
+    /**
+     * @brief Get false positive probability
+     * @return Current estimated false positive rate
+     */
+    double getFalsePositiveRate() const;
+    
+    /**
+     * @brief Get memory usage in bytes
+     * @return Memory consumption
+     */
+    size_t getMemoryUsage() const;
+
+private:
+    static constexpr size_t kCounterShards = 16;
+
+    struct alignas(64) CounterShard {
+        std::atomic<size_t> count{0};
+    };
+
+    std::unique_ptr<std::atomic<uint64_t>[]> words_;
+    size_t numWords_;
+    size_t numHashFunctions_;
+    size_t bitArraySize_;
+    CounterShard counters_[kCounterShards];
+    
+    // Shard used by the calling thread
+    static size_t counterShard();
+};
+
+} // namespace kinepredict
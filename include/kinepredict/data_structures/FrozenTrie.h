@@ -0,0 +1,97 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <cstdint>
+
+namespace kinepredict {
+
+class Trie;
+
+/**
+ * @brief Immutable double-array trie for read-only keyword dictionaries
+ * 
+ * Built once from a Trie (see Trie::freeze()) and then queried many
+ * times. Every node lives in a few flat arrays: the child reached by
+ * character c from node s is base[s] + c, valid if check[] points back to
+ * s. A lookup is one array access and one compare per character, with no
+ * heap allocation or hashing, and the whole dictionary is a handful of
+ * contiguous buffers.
+ * 
+ * Same semantics as Trie for search, startsWith and getWordsWithPrefix
+ * (results come out in byte order).
+ * 
+ * Time Complexity:
+ * - Build: O(N * A) for N nodes and alphabet size A
+ * - Search: O(m)
+ * - StartsWith: O(m)
+ */
+class FrozenTrie {
+public:
+    /**
+     * @brief Construct an empty dictionary
+     */
+    FrozenTrie();
+    
+    /**
+     * @brief Build from a mutable trie
+     * @param trie The trie to copy
+     */
+    explicit FrozenTrie(const Trie& trie);
+    
+    /**
+     * @brief Search for exact word match
+     * @param word The word to search for
+     * @return true if word exists, false otherwise
+     */
+    bool search(std::string_view word) const;
+    
+    /**
+     * @brief Check if any word starts with given prefix
+     * @param prefix The prefix to check
+     * @return true if prefix exists, false otherwise
+     */
+    bool startsWith(std::string_view prefix) const;
+    
+    /**
+     * @brief Get all words with given prefix (autocomplete)
+     * @param prefix The prefix
+     * @return Vector of words matching prefix, in byte order
+     */
+    std::vector<std::string> getWordsWithPrefix(std::string_view prefix) const;
+    
+    /**
+     * @brief Get number of words
+     * @return Word count
+     */
+    size_t size() const { return wordCount_; }
+    
+    /**
+     * @brief Get memory usage in bytes
+     * @return Memory consumption of the arrays
+     */
+    size_t getMemoryUsage() const;
+
+private:
+    static constexpr uint32_t kNone = UINT32_MAX;
+    static constexpr uint32_t kRoot = 0;
+    static constexpr size_t kMaxBaseTries = 32;  // Free slots scanned before giving up on the oldest
+
+    // Per-slot arrays, indexed by node id
+    std::vector<uint32_t> base_;
+    std::vector<uint32_t> check_;        // Parent node id, kNone if slot free
+    std::vector<uint16_t> firstChild_;   // Smallest child code, 0 if leaf
+    std::vector<uint16_t> nextSibling_;  // Next larger sibling code, 0 if last
+    std::vector<uint64_t> terminal_;     // One bit per slot: end of word
+    size_t wordCount_;
+    
+    // Codes 1..256; 0 means "no child"
+    static uint16_t code(char c) { return static_cast<uint16_t>(static_cast<unsigned char>(c)) + 1; }
+    
+    uint32_t walk(std::string_view key) const;
+    bool isTerminal(uint32_t node) const { return (terminal_[node >> 6] >> (node & 63)) & 1; }
+    void ensureSlots(size_t count);
+};
+
+} // namespace kinepredict
@@ -0,0 +1,241 @@
+#pragma once
+
+#include <vector>
+#include <functional>
+#include <stdexcept>
+#include <utility>
+#include <string>
+#include <cstdint>
+
+namespace kinepredict {
+
+/**
+ * @brief d-ary heap of handles whose priorities can change in place
+ * 
+ * Used for:
+ * - Live re-scoring: headline CTR updates move entries up or down
+ * - One long-running heap per campaign without stale duplicates
+ * 
+ * Handles are caller-chosen small integers (e.g. dense headline IDs).
+ * A handle -> heap position table makes update() and erase() O(log n)
+ * instead of a rebuild or a lazy-deletion scheme. Priorities and handles
+ * are kept in separate arrays so sifts compare contiguous priorities.
+ * The position table grows to the largest handle pushed.
+ * 
+ * Time Complexity:
+ * - Push / Update / Erase / Pop: O(d log_d n)
+ * - Contains / Peek: O(1)
+ */
+template<typename Priority, typename Compare = std::less<Priority>, size_t Arity = 4>
+class IndexedPriorityQueue {
+    static_assert(Arity >= 2, "IndexedPriorityQueue arity must be at least 2");
+
+public:
+    using Handle = uint32_t;
+
+    IndexedPriorityQueue() = default;
+    
+    /**
+     * @brief Construct with a comparator instance
+     * @param comp Returns true if its first priority ranks ahead
+     */
+    explicit IndexedPriorityQueue(const Compare& comp) : comp_(comp) {}
+    
+    /**
+     * @brief Insert a handle
+     * @param handle Identifier, not currently in the queue
+     * @param priority Its priority
+     * @throws std::invalid_argument if handle is already queued
+     */
+    void push(Handle handle, Priority priority) {
+        if (contains(handle)) {
+            throw std::invalid_argument("IndexedPriorityQueue::push() handle already present");
+        }
+        if (handle >= positions_.size()) {
+            positions_.resize(static_cast<size_t>(handle) + 1, kAbsent);
+        }
+        priorities_.push_back(std::move(priority));
+        handles_.push_back(handle);
+        positions_[handle] = priorities_.size() - 1;
+        siftUp(priorities_.size() - 1);
+    }
+    
+    /**
+     * @brief Change the priority of a queued handle
+     * @param handle Queued identifier
+     * @param priority New priority (may rank higher or lower)
+     * @throws std::invalid_argument if handle is not queued
+     */
+    void update(Handle handle, Priority priority) {
+        size_t position = positionOf(handle, "update");
+        bool promoted = comp_(priority, priorities_[position]);
+        priorities_[position] = std::move(priority);
+        if (promoted) siftUp(position);
+        else siftDown(position);
+    }
+    
+    /**
+     * @brief Remove a queued handle
+     * @param handle Queued identifier
+     * @throws std::invalid_argument if handle is not queued
+     */
+    void erase(Handle handle) {
+        removeAt(positionOf(handle, "erase"));
+    }
+    
+    /**
+     * @brief Check whether a handle is queued
+     * @param handle Identifier
+     * @return true if queued
+     */
+    bool contains(Handle handle) const {
+        return handle < positions_.size() && positions_[handle] != kAbsent;
+    }
+    
+    /**
+     * @brief Get the priority of a queued handle
+     * @param handle Queued identifier
+     * @return Reference to its priority
+     * @throws std::invalid_argument if handle is not queued
+     */
+    const Priority& priority(Handle handle) const {
+        return priorities_[positionOf(handle, "priority")];
+    }
+    
+    /**
+     * @brief Remove and return the top handle
+     * @return Handle and priority ranking first
+     */
+    std::pair<Handle, Priority> pop() {
+        if (empty()) {
+            throw std::runtime_error("IndexedPriorityQueue::pop() called on empty queue");
+        }
+        std::pair<Handle, Priority> topEntry(handles_[0], priorities_[0]);
+        removeAt(0);
+        return topEntry;
+    }
+    
+    /**
+     * @brief View the top handle without removing
+     * @return Handle ranking first
+     */
+    Handle topHandle() const {
+        if (empty()) {
+            throw std::runtime_error("IndexedPriorityQueue::topHandle() called on empty queue");
+        }
+        return handles_[0];
+    }
+    
+    /**
+     * @brief View the top priority without removing
+     * @return Reference to the highest priority
+     */
+    const Priority& topPriority() const {
+        if (empty()) {
+            throw std::runtime_error("IndexedPriorityQueue::topPriority() called on empty queue");
+        }
+        return priorities_[0];
+    }
+    
+    /**
+     * @brief Check if queue is empty
+     * @return true if empty
+     */
+    bool empty() const { return priorities_.empty(); }
+    
+    /**
+     * @brief Get number of queued handles
+     * @return Size of queue
+     */
+    size_t size() const { return priorities_.size(); }
+    
+    /**
+     * @brief Remove all handles
+     */
+    void clear() {
+        priorities_.clear();
+        handles_.clear();
+        positions_.clear();
+    }
+
+private:
+    static constexpr size_t kAbsent = SIZE_MAX;
+
+    std::vector<Priority> priorities_;
+    std::vector<Handle> handles_;       // Heap-ordered alongside priorities_
+    std::vector<size_t> positions_;     // Handle -> heap index, or kAbsent
+    Compare comp_;
+    
+    size_t positionOf(Handle handle, const char* operation) const {
+        if (!contains(handle)) {
+            throw std::invalid_argument(std::string("IndexedPriorityQueue::") + operation +
+                                        "() handle not present");
+        }
+        return positions_[handle];
+    }
+    
+    // Move the last entry into the hole and restore order in whichever direction it needs
+    void removeAt(size_t position) {
+        positions_[handles_[position]] = kAbsent;
+        size_t last = priorities_.size() - 1;
+        if (position != last) {
+            priorities_[position] = std::move(priorities_[last]);
+            handles_[position] = handles_[last];
+            positions_[handles_[position]] = position;
+        }
+        priorities_.pop_back();
+        handles_.pop_back();
+        
+        if (position < priorities_.size()) {
+            if (position > 0 && comp_(priorities_[position], priorities_[parent(position)])) {
+                siftUp(position);
+            } else {
+                siftDown(position);
+            }
+        }
+    }
+    
+    void place(size_t index, Priority&& priority, Handle handle) {
+        priorities_[index] = std::move(priority);
+        handles_[index] = handle;
+        positions_[handle] = index;
+    }
+    
+    void siftUp(size_t index) {
+        Priority priority = std::move(priorities_[index]);
+        Handle handle = handles_[index];
+        while (index > 0) {
+            size_t parentIdx = parent(index);
+            if (!comp_(priority, priorities_[parentIdx])) break;
+            place(index, std::move(priorities_[parentIdx]), handles_[parentIdx]);
+            index = parentIdx;
+        }
+        place(index, std::move(priority), handle);
+    }
+    
+    void siftDown(size_t index) {
+        const size_t count = priorities_.size();
+        Priority priority = std::move(priorities_[index]);
+        Handle handle = handles_[index];
+        while (true) {
+            size_t first = firstChild(index);
+            if (first >= count) break;
+            
+            size_t last = first + Arity < count ? first + Arity : count;
+            size_t best = first;
+            for (size_t child = first + 1; child < last; ++child) {
+                if (comp_(priorities_[child], priorities_[best])) best = child;
+            }
+            
+            if (!comp_(priorities_[best], priority)) break;
+            place(index, std::move(priorities_[best]), handles_[best]);
+            index = best;
+        }
+        place(index, std::move(priority), handle);
+    }
+    
+    static size_t parent(size_t i) { return (i - 1) / Arity; }
+    static size_t firstChild(size_t i) { return Arity * i + 1; }
+};
+
+} // namespace kinepredict
@@ -0,0 +1,158 @@
+#pragma once
+
+#include <vector>
+#include <functional>
+#include <stdexcept>
+#include <utility>
+
+namespace kinepredict {
+
+/**
+ * @brief d-ary heap with keys and payloads in separate arrays
+ * 
+ * Used for:
+ * - Ranking large records (headline text, metadata) by a small score
+ * 
+ * Same algorithm as PriorityQueue, but comparisons only touch the
+ * contiguous key array, so a sift step reads Arity keys from one cache
+ * line instead of Arity full records. Payloads move in lockstep with
+ * their keys and are never compared.
+ * 
+ * Time Complexity:
+ * - Insert: O(log_d n)
+ * - ExtractMin/Max: O(d log_d n)
+ * - Peek: O(1)
+ */
+template<typename Key, typename Value, typename Compare = std::less<Key>, size_t Arity = 4>
+class KeyedPriorityQueue {
+    static_assert(Arity >= 2, "KeyedPriorityQueue arity must be at least 2");
+
+public:
+    KeyedPriorityQueue() = default;
+    
+    /**
+     * @brief Construct with a key comparator instance
+     * @param comp Returns true if its first key has higher priority
+     */
+    explicit KeyedPriorityQueue(const Compare& comp) : comp_(comp) {}
+    
+    /**
+     * @brief Insert a payload with its priority key
+     * @param key Priority key
+     * @param value Payload
+     */
+    void push(Key key, Value value) {
+        keys_.push_back(std::move(key));
+        values_.push_back(std::move(value));
+        siftUp(keys_.size() - 1);
+    }
+    
+    /**
+     * @brief Remove and return top entry
+     * @return Key and payload with the highest priority
+     */
+    std::pair<Key, Value> pop() {
+        if (empty()) {
+            throw std::runtime_error("KeyedPriorityQueue::pop() called on empty queue");
+        }
+        
+        std::pair<Key, Value> topEntry(std::move(keys_[0]), std::move(values_[0]));
+        Key lastKey = std::move(keys_.back());
+        Value lastValue = std::move(values_.back());
+        keys_.pop_back();
+        values_.pop_back();
+        
+        if (!empty()) {
+            siftDown(0, std::move(lastKey), std::move(lastValue));
+        }
+        
+        return topEntry;
+    }
+    
+    /**
+     * @brief View top key without removing
+     * @return Reference to the highest-priority key
+     */
+    const Key& topKey() const {
+        if (empty()) {
+            throw std::runtime_error("KeyedPriorityQueue::topKey() called on empty queue");
+        }
+        return keys_[0];
+    }
+    
+    /**
+     * @brief View top payload without removing
+     * @return Reference to the payload of the highest-priority key
+     */
+    const Value& topValue() const {
+        if (empty()) {
+            throw std::runtime_error("KeyedPriorityQueue::topValue() called on empty queue");
+        }
+        return values_[0];
+    }
+    
+    /**
+     * @brief Check if queue is empty
+     * @return true if empty
+     */
+    bool empty() const { return keys_.empty(); }
+    
+    /**
+     * @brief Get number of entries
+     * @return Size of queue
+     */
+    size_t size() const { return keys_.size(); }
+    
+    /**
+     * @brief Remove all entries
+     */
+    void clear() {
+        keys_.clear();
+        values_.clear();
+    }
+
+private:
+    std::vector<Key> keys_;
+    std::vector<Value> values_;
+    Compare comp_;
+    
+    void siftUp(size_t index) {
+        Key key = std::move(keys_[index]);
+        Value value = std::move(values_[index]);
+        while (index > 0) {
+            size_t parentIdx = parent(index);
+            if (!comp_(key, keys_[parentIdx])) break;
+            keys_[index] = std::move(keys_[parentIdx]);
+            values_[index] = std::move(values_[parentIdx]);
+            index = parentIdx;
+        }
+        keys_[index] = std::move(key);
+        values_[index] = std::move(value);
+    }
+    
+    void siftDown(size_t index, Key key, Value value) {
+        const size_t count = keys_.size();
+        while (true) {
+            size_t first = firstChild(index);
+            if (first >= count) break;
+            
+            size_t last = first + Arity < count ? first + Arity : count;
+            size_t best = first;
+            for (size_t child = first + 1; child < last; ++child) {
+                if (comp_(keys_[child], keys_[best])) best = child;
+            }
+            
+            if (!comp_(keys_[best], key)) break;
+            keys_[index] = std::move(keys_[best]);
+            values_[index] = std::move(values_[best]);
+            index = best;
+        }
+        keys_[index] = std::move(key);
+        values_[index] = std::move(value);
+    }
+    
+    static size_t parent(size_t i) { return (i - 1) / Arity; }
+    static size_t firstChild(size_t i) { return Arity * i + 1; }
+};
+
+} // namespace kinepredict
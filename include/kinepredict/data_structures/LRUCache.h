@@ -0,0 +1,334 @@
+#pragma once
+
+#include "kinepredict/core/Hash.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace kinepredict {
+
+/**
+ * @brief Bytes charged against an LRUCache budget for a value
+ *
+ * Specialize for values that own heap memory.
+ */
+template<typename Value>
+struct CacheCharge {
+    size_t operator()(const Value&) const { return sizeof(Value); }
+};
+
+template<>
+struct CacheCharge<std::string> {
+    size_t operator()(const std::string& value) const { return sizeof(std::string) + value.capacity(); }
+};
+
+/**
+ * @brief Sharded thread-safe LRU cache with a byte budget and per-entry TTL
+ *
+ * Used for:
+ * - Caching prediction results for repeated headlines, keyed by
+ *   hash64() of the normalized text (TextProcessor::normalize)
+ *
+ * Keys are spread over independent shards, each with its own mutex, hash
+ * index and recency list, so threads touching different keys rarely
+ * contend. Each shard gets an equal slice of the byte budget (keys are
+ * hashes, so slices fill evenly) and evicts its least recently used
+ * entries when an insert would exceed it. An entry is charged
+ * CacheCharge<Value> plus a fixed bookkeeping overhead.
+ *
+ * Expired entries are dropped lazily: by the get() that finds them, or
+ * when they reach the cold end of the list. Hit, miss, eviction and
+ * expiration counters are kept per shard under the shard lock, so
+ * counting adds no shared cache-line traffic.
+ *
+ * Recency links are 32-bit indices into a per-shard node array, with
+ * freed nodes recycled through a free list.
+ *
+ * Time Complexity: O(1) average get/put/erase
+ * Space Complexity: O(n) bounded by the byte budget
+ */
+template<typename Value, typename Charge = CacheCharge<Value>, typename Clock = std::chrono::steady_clock>
+class LRUCache {
+public:
+    using Key = uint64_t;
+    using Duration = typename Clock::duration;
+
+    static constexpr size_t kDefaultShards = 64;
+
+    /** @brief Approximate bookkeeping bytes per entry (node, index entry, bucket) */
+    static constexpr size_t kEntryOverhead = 64;
+
+    struct Stats {
+        size_t hits = 0;
+        size_t misses = 0;
+        size_t evictions = 0;     // Dropped to stay within the budget
+        size_t expirations = 0;   // Dropped because their TTL passed
+        size_t entries = 0;
+        size_t bytes = 0;
+
+        double hitRate() const { return hits + misses > 0 ? static_cast<double>(hits) / (hits + misses) : 0.0; }
+    };
+
+    /**
+     * @brief Construct an empty cache
+     * @param byteBudget Total bytes across all shards
+     * @param defaultTtl Lifetime for put() without a TTL (zero: no expiry)
+     * @param numShards Number of shards, rounded up to a power of two
+     * @throws std::invalid_argument if byteBudget or numShards is 0
+     */
+    explicit LRUCache(size_t byteBudget, Duration defaultTtl = Duration::zero(),
+                      size_t numShards = kDefaultShards)
+    : defaultTtl_(defaultTtl) {
+        if (byteBudget == 0 || numShards == 0) {
+            throw std::invalid_argument("LRUCache budget and shard count must be positive");
+        }
+        size_t shards = 1;
+        while (shards < numShards) {
+            shards <<= 1;
+        }
+        shardMask_ = shards - 1;
+        shardBudget_ = std::max<size_t>(1, byteBudget / shards);
+        shards_.reset(new Shard[shards]);
+    }
+
+    LRUCache(const LRUCache&) = delete;
+    LRUCache& operator=(const LRUCache&) = delete;
+
+    /**
+     * @brief Insert or replace an entry with the default TTL
+     * @param key Entry key
+     * @param value Value to cache
+     * @return false if the entry alone exceeds a shard's budget (not cached)
+     */
+    bool put(Key key, Value value) {
+        return put(key, std::move(value), defaultTtl_);
+    }
+
+    /**
+     * @brief Insert or replace an entry
+     * @param key Entry key
+     * @param value Value to cache
+     * @param ttl Lifetime from now (zero, or too long to represent: no expiry)
+     * @return false if the entry alone exceeds a shard's budget (not cached)
+     */
+    bool put(Key key, Value value, Duration ttl) {
+        size_t charge = Charge()(value) + kEntryOverhead;
+        auto now = Clock::now();
+        auto expires = ttl == Duration::zero() || ttl >= Clock::time_point::max() - now
+                       ? Clock::time_point::max() : now + ttl;
+
+        Shard& shard = shardFor(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto it = shard.index.find(key);
+        if (charge > shardBudget_) {
+            if (it != shard.index.end()) {
+                remove(shard, it);
+            }
+            return false;
+        }
+
+        uint32_t node;
+        if (it != shard.index.end()) {
+            node = it->second;
+            shard.bytes -= shard.nodes[node].charge;
+            unlink(shard, node);
+        } else {
+            node = allocate(shard);
+            shard.index.emplace(key, node);
+        }
+        Node& entry = shard.nodes[node];
+        entry.key = key;
+        entry.value = std::move(value);
+        entry.charge = charge;
+        entry.expires = expires;
+        pushFront(shard, node);
+        shard.bytes += charge;
+
+        if (shard.bytes > shardBudget_) {
+            auto now = Clock::now();
+            while (shard.bytes > shardBudget_) {
+                const Node& victim = shard.nodes[shard.tail];
+                if (victim.expires <= now) {
+                    ++shard.expirations;
+                } else {
+                    ++shard.evictions;
+                }
+                remove(shard, shard.index.find(victim.key));
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Look up an entry and mark it most recently used
+     * @param key Entry key
+     * @return Copy of the value, or nullopt if absent or expired
+     */
+    std::optional<Value> get(Key key) {
+        Shard& shard = shardFor(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto it = shard.index.find(key);
+        if (it == shard.index.end()) {
+            ++shard.misses;
+            return std::nullopt;
+        }
+        uint32_t node = it->second;
+        if (shard.nodes[node].expires != Clock::time_point::max() && shard.nodes[node].expires <= Clock::now()) {
+            remove(shard, it);
+            ++shard.expirations;
+            ++shard.misses;
+            return std::nullopt;
+        }
+        if (shard.head != node) {
+            unlink(shard, node);
+            pushFront(shard, node);
+        }
+        ++shard.hits;
+        return shard.nodes[node].value;
+    }
+
+    /**
+     * @brief Remove an entry
+     * @param key Entry key
+     * @return true if the entry was present
+     */
+    bool erase(Key key) {
+        Shard& shard = shardFor(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto it = shard.index.find(key);
+        if (it == shard.index.end()) {
+            return false;
+        }
+        remove(shard, it);
+        return true;
+    }
+
+    /**
+     * @brief Remove all entries (counters are kept)
+     */
+    void clear() {
+        for (size_t i = 0; i <= shardMask_; ++i) {
+            Shard& shard = shards_[i];
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            shard.index.clear();
+            shard.nodes.clear();
+            shard.freeNodes.clear();
+            shard.head = shard.tail = kNil;
+            shard.bytes = 0;
+        }
+    }
+
+    /**
+     * @brief Sum the per-shard counters
+     * @return Counters and current size (a consistent snapshot per shard)
+     */
+    Stats stats() const {
+        Stats total;
+        for (size_t i = 0; i <= shardMask_; ++i) {
+            const Shard& shard = shards_[i];
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            total.hits += shard.hits;
+            total.misses += shard.misses;
+            total.evictions += shard.evictions;
+            total.expirations += shard.expirations;
+            total.entries += shard.index.size();
+            total.bytes += shard.bytes;
+        }
+        return total;
+    }
+
+    size_t byteBudget() const { return shardBudget_ * numShards(); }
+    size_t numShards() const { return shardMask_ + 1; }
+
+private:
+    static constexpr uint32_t kNil = UINT32_MAX;
+
+    struct Node {
+        Key key = 0;
+        std::optional<Value> value;
+        typename Clock::time_point expires;
+        size_t charge = 0;
+        uint32_t prev = kNil;   // Towards the most recently used end
+        uint32_t next = kNil;
+    };
+
+    struct alignas(64) Shard {
+        mutable std::mutex mutex;
+        std::unordered_map<Key, uint32_t> index;
+        std::vector<Node> nodes;
+        std::vector<uint32_t> freeNodes;
+        uint32_t head = kNil;   // Most recently used
+        uint32_t tail = kNil;   // Least recently used
+        size_t bytes = 0;
+        size_t hits = 0;
+        size_t misses = 0;
+        size_t evictions = 0;
+        size_t expirations = 0;
+    };
+
+    std::unique_ptr<Shard[]> shards_;
+    size_t shardMask_;
+    size_t shardBudget_;
+    Duration defaultTtl_;
+
+    Shard& shardFor(Key key) const {
+        return shards_[hashMix(key) & shardMask_];
+    }
+
+    static uint32_t allocate(Shard& shard) {
+        if (!shard.freeNodes.empty()) {
+            uint32_t node = shard.freeNodes.back();
+            shard.freeNodes.pop_back();
+            return node;
+        }
+        if (shard.nodes.size() >= kNil) {
+            throw std::length_error("LRUCache shard is full");
+        }
+        shard.nodes.emplace_back();
+        return static_cast<uint32_t>(shard.nodes.size() - 1);
+    }
+
+    static void pushFront(Shard& shard, uint32_t node) {
+        Node& entry = shard.nodes[node];
+        entry.prev = kNil;
+        entry.next = shard.head;
+        if (shard.head != kNil) {
+            shard.nodes[shard.head].prev = node;
+        } else {
+            shard.tail = node;
+        }
+        shard.head = node;
+    }
+
+    static void unlink(Shard& shard, uint32_t node) {
+        Node& entry = shard.nodes[node];
+        if (entry.prev != kNil) {
+            shard.nodes[entry.prev].next = entry.next;
+        } else {
+            shard.head = entry.next;
+        }
+        if (entry.next != kNil) {
+            shard.nodes[entry.next].prev = entry.prev;
+        } else {
+            shard.tail = entry.prev;
+        }
+    }
+
+    static void remove(Shard& shard, typename std::unordered_map<Key, uint32_t>::iterator it) {
+        uint32_t node = it->second;
+        unlink(shard, node);
+        shard.bytes -= shard.nodes[node].charge;
+        shard.nodes[node].value.reset();   // Release the value's memory now
+        shard.freeNodes.push_back(node);
+        shard.index.erase(it);
+    }
+};
+
+} // namespace kinepredict
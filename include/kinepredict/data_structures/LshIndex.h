@@ -0,0 +1,122 @@
+#pragma once
+
+#include <cstddef>
+#include <unordered_map>
+#include <vector>
+#include <cstdint>
+
+namespace kinepredict {
+
+/**
+ * @brief Banded LSH index over MinHash signatures
+ *
+ * Used for:
+ * - Finding near-duplicate headlines without comparing against every
+ *   stored one
+ *
+ * A signature of K slots is cut into b bands of r rows. Two items become
+ * candidates when all r rows of at least one band agree, which happens
+ * with probability 1 - (1 - s^r)^b for Jaccard similarity s: an S-curve
+ * whose steep part sits near (1/b)^(1/r). The constructor picks b and r
+ * from the Jaccard threshold, weighting missed items above it more than
+ * spurious candidates below it. Candidates are then filtered on their
+ * full signature estimate, so results approximate "similarity >= threshold".
+ *
+ * Each band maps a bucket key to the newest item in the bucket; older
+ * items are chained through a flat next-array, so an insert costs one
+ * hash-map probe per band and 4 bytes per band.
+ *
+ * An empty signature (every slot UINT32_MAX, what MinHash gives a text
+ * with no tokens) carries no similarity information. Such items get an id
+ * but are left out of the band buckets, and an empty query has no
+ * candidates: otherwise every blank headline would share one bucket per
+ * band and each blank query would walk all of them.
+ *
+ * Time Complexity: O(K) insert, O(K + c * K) query for c candidates
+ * Space Complexity: O(n * K) for n items
+ */
+class LshIndex {
+public:
+    using Id = uint32_t;
+
+    struct Match {
+        Id id;
+        double similarity;   // Estimated from the signatures
+    };
+
+    /**
+     * @brief Construct an index for a similarity threshold
+     * @param numHashes Signature length (MinHash::numHashes())
+     * @param threshold Jaccard similarity to report (0.0 to 1.0]
+     * @throws std::invalid_argument if numHashes is 0 or threshold is out of range
+     */
+    LshIndex(size_t numHashes, double threshold);
+
+    /**
+     * @brief Add a signature
+     * @param signature Signature of numHashes() slots
+     * @return Id of the new item (ids are assigned 0, 1, 2, ...); empty
+     *         signatures get an id but are never returned as candidates
+     * @throws std::invalid_argument if the signature length is wrong
+     */
+    Id insert(const std::vector<uint32_t>& signature);
+
+    /**
+     * @brief Find stored items sharing at least one band with a signature
+     * @param signature Signature of numHashes() slots
+     * @param candidates Output, cleared first; ascending, no repeats
+     *        (none for an empty signature)
+     */
+    void candidates(const std::vector<uint32_t>& signature, std::vector<Id>& candidates) const;
+
+    /**
+     * @brief Find stored items whose estimated similarity reaches the threshold
+     * @param signature Signature of numHashes() slots
+     * @return Matches, most similar first (ties by id)
+     */
+    std::vector<Match> query(const std::vector<uint32_t>& signature) const;
+
+    /**
+     * @brief Check for the signature of a text without shingles
+     * @param signature Signature to test
+     * @return true if every slot is UINT32_MAX
+     */
+    static bool isEmpty(const std::vector<uint32_t>& signature);
+
+    /**
+     * @brief Get the stored signature of an item
+     * @param id Item id
+     * @return Pointer to numHashes() slots
+     */
+    const uint32_t* signatureOf(Id id) const { return &signatures_[static_cast<size_t>(id) * numHashes_]; }
+
+    size_t size() const { return count_; }
+    size_t numHashes() const { return numHashes_; }
+    size_t numBands() const { return numBands_; }
+    size_t rowsPerBand() const { return rowsPerBand_; }
+    double threshold() const { return threshold_; }
+
+    /**
+     * @brief Probability that an item of a given similarity becomes a candidate
+     * @param similarity Jaccard similarity
+     * @return 1 - (1 - s^r)^b for this index's bands
+     */
+    double candidateProbability(double similarity) const;
+
+private:
+    static constexpr Id kNone = UINT32_MAX;
+
+    size_t numHashes_;
+    size_t numBands_;
+    size_t rowsPerBand_;
+    double threshold_;
+    size_t count_;
+    std::vector<uint32_t> signatures_;                    // count_ x numHashes_
+    std::vector<std::unordered_map<uint64_t, Id>> heads_; // Per band: key -> newest item
+    std::vector<Id> next_;                                // [id * numBands_ + band] -> older item
+
+    uint64_t bandKey(const uint32_t* signature, size_t band) const;
+    void checkLength(const std::vector<uint32_t>& signature) const;
+};
+
+} // namespace kinepredict
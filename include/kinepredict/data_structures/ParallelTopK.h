@@ -0,0 +1,161 @@
+#pragma once
+
+#include "kinepredict/data_structures/PriorityQueue.h"
+#include "kinepredict/data_structures/TopK.h"
+#include <vector>
+#include <thread>
+#include <exception>
+#include <functional>
+#include <stdexcept>
+#include <algorithm>
+
+namespace kinepredict {
+
+/**
+ * @brief Rank items scored on worker threads without a shared heap
+ * 
+ * Used for:
+ * - /batch requests scoring 100k+ headline variants across cores
+ * 
+ * Each worker scores a contiguous range of item indices into its own
+ * TopK, so there are no locks or shared cache lines while scoring. The
+ * per-thread runs, each sorted best first, are then combined with a
+ * k-way merge over a PriorityQueue of run heads. Pass k = count for a
+ * full ranking.
+ * 
+ * Compare has the same meaning as for PriorityQueue: comp(a, b) is true
+ * if a ranks ahead of b.
+ * 
+ * Time Complexity: O(n / threads * log k) scoring, O(k log threads) merge
+ */
+template<typename T, typename Compare = std::less<T>, size_t Arity = 4>
+class ParallelTopK {
+public:
+    /**
+     * @brief Configure a ranker
+     * @param k Number of results to keep (must be positive)
+     * @param numThreads Worker threads (0 means hardware concurrency)
+     * @param comp Returns true if its first argument ranks ahead
+     */
+    ParallelTopK(size_t k, size_t numThreads, const Compare& comp = Compare())
+    : k_(k), numThreads_(numThreads != 0 ? numThreads : std::max(1u, std::thread::hardware_concurrency())),
+      comp_(comp) {
+        if (k == 0) {
+            throw std::invalid_argument("ParallelTopK capacity must be positive");
+        }
+    }
+    
+    /**
+     * @brief Score items 0..count-1 and return the best k
+     * @param count Number of items
+     * @param produce Callable size_t -> T (scores one item); called
+     *        concurrently from worker threads
+     * @return Up to k elements, best first
+     * @throws Whatever produce throws (the first worker's, once all have stopped)
+     */
+    template<typename Producer>
+    std::vector<T> run(size_t count, Producer&& produce) const {
+        size_t workers = std::max<size_t>(1, std::min(numThreads_, count));
+        size_t perThread = (count + workers - 1) / std::max<size_t>(1, workers);
+        std::vector<std::vector<T>> runs(workers);
+        
+        auto scoreRange = [&](size_t worker) {
+            size_t begin = worker * perThread;
+            size_t end = std::min(count, begin + perThread);
+            if (begin >= end) return;
+            
+            TopK<T, Compare, Arity> local(std::min(k_, end - begin), comp_);
+            for (size_t i = begin; i < end; ++i) {
+                local.offer(produce(i));
+            }
+            runs[worker] = local.drainSorted();
+        };
+        
+        // produce is caller code: an exception must not escape a thread,
+        // and every thread must be joined before run() unwinds
+        std::vector<std::exception_ptr> errors(workers);
+        auto guardedRange = [&](size_t worker) {
+            try {
+                scoreRange(worker);
+            } catch (...) {
+                errors[worker] = std::current_exception();
+            }
+        };
+        
+        std::vector<std::thread> threads;
+        auto joinAll = [&threads] {
+            for (auto& thread : threads) {
+                thread.join();
+            }
+        };
+        try {
+            for (size_t worker = 1; worker < workers; ++worker) {
+                threads.emplace_back(guardedRange, worker);
+            }
+        } catch (...) {
+            joinAll();
+            throw;
+        }
+        guardedRange(0);  // The calling thread takes the first range
+        joinAll();
+        for (const auto& error : errors) {
+            if (error) {
+                std::rethrow_exception(error);
+            }
+        }
+        
+        return merge(std::move(runs), k_, comp_);
+    }
+    
+    /**
+     * @brief K-way merge of runs that are each sorted best first
+     * @param runs Sorted runs (consumed)
+     * @param k Maximum number of results
+     * @param comp Returns true if its first argument ranks ahead
+     * @return Up to k elements, best first
+     */
+    static std::vector<T> merge(std::vector<std::vector<T>> runs, size_t k,
+                                const Compare& comp = Compare()) {
+        struct Head {
+            size_t run;
+            size_t index;
+        };
+        struct HeadOrder {
+            const std::vector<std::vector<T>>* runs;
+            Compare comp;
+            bool operator()(const Head& a, const Head& b) const {
+                return comp((*runs)[a.run][a.index], (*runs)[b.run][b.index]);
+            }
+        };
+        
+        std::vector<Head> heads;
+        size_t total = 0;
+        for (size_t r = 0; r < runs.size(); ++r) {
+            if (!runs[r].empty()) heads.push_back({r, 0});
+            total += runs[r].size();
+        }
+        PriorityQueue<Head, HeadOrder, Arity> frontier(std::move(heads), HeadOrder{&runs, comp});
+        
+        std::vector<T> merged;
+        merged.reserve(std::min(k, total));
+        while (merged.size() < k && !frontier.empty()) {
+            Head head = frontier.top();
+            merged.push_back(std::move(runs[head.run][head.index]));
+            
+            // Advance the winning run in place, or retire it
+            if (head.index + 1 < runs[head.run].size()) {
+                frontier.replaceTop({head.run, head.index + 1});
+            } else {
+                frontier.pop();
+            }
+        }
+        return merged;
+    }
+
+private:
+    size_t k_;
+    size_t numThreads_;
+    Compare comp_;
+};
+
+} // namespace kinepredict
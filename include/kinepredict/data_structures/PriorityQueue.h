@@ -3,6 +3,8 @@
 #include <vector>
 #include <functional>
 #include <stdexcept>
+#include <utility>
+#include <algorithm>
 
 namespace kinepredict {
 
@@ -14,28 +16,61 @@ namespace kinepredict {
  * - K-best predictions
  * - Top-N recommendations
  * 
+ * A d-ary heap: each node has Arity children stored contiguously, so a
+ * sift-down step compares siblings that share a cache line and the tree
+ * is log2(Arity) times shallower than a binary heap. Sifting moves a
+ * "hole" instead of swapping, so each level costs one move, not three.
+ * 
  * Time Complexity:
- * - Insert: O(log n)
- * - ExtractMin/Max: O(log n)
+ * - Insert: O(log_d n)
+ * - ExtractMin/Max: O(d log_d n)
  * - Peek: O(1)
+ * - Bulk build (constructor/assign): O(n)
  */
-template<typename T, typename Compare = std::less<T>>
+template<typename T, typename Compare = std::less<T>, size_t Arity = 4>
 class PriorityQueue {
+    static_assert(Arity >= 2, "PriorityQueue arity must be at least 2");
+
 public:
     PriorityQueue() = default;
     
+    /**
+     * @brief Construct with a comparator instance
+     * @param comp Returns true if its first argument has higher priority
+     */
+    explicit PriorityQueue(const Compare& comp) : comp_(comp) {}
+    
+    /**
+     * @brief Take ownership of elements and heapify them in O(n)
+     * @param elements Elements in any order (moved in, no copies)
+     * @param comp Returns true if its first argument has higher priority
+     */
+    explicit PriorityQueue(std::vector<T> elements, const Compare& comp = Compare())
+    : heap_(std::move(elements)), comp_(comp) {
+        heapify();
+    }
+    
+    /**
+     * @brief Replace the contents with elements, heapified in O(n)
+     * @param elements Elements in any order (moved in, no copies)
+     */
+    void assign(std::vector<T> elements) {
+        heap_ = std::move(elements);
+        heapify();
+    }
+    
     /**
      * @brief Insert element into queue
      * @param element The element to insert
      */
     void push(const T& element) {
         heap_.push_back(element);
-        heapifyUp(heap_.size() - 1);
+        siftUp(heap_.size() - 1);
     }
     
     void push(T&& element) {
         heap_.push_back(std::move(element));
-        heapifyUp(heap_.size() - 1);
+        siftUp(heap_.size() - 1);
     }
     
     /**
@@ -48,16 +83,58 @@ public:
         }
         
         T topElement = std::move(heap_[0]);
-        heap_[0] = std::move(heap_.back());
+        T last = std::move(heap_.back());
         heap_.pop_back();
         
         if (!empty()) {
-            heapifyDown(0);
+            siftDown(0, std::move(last));
+        }
+        
+        return topElement;
+    }
+    
+    /**
+     * @brief Pop the top element and push element in one sift
+     * 
+     * Cheaper than pop() followed by push(), and the usual way to keep
+     * a bounded heap full.
+     * 
+     * @param element The element to insert
+     * @return The previous top element
+     */
+    T replaceTop(T element) {
+        if (empty()) {
+            throw std::runtime_error("PriorityQueue::replaceTop() called on empty queue");
         }
         
+        T topElement = std::move(heap_[0]);
+        siftDown(0, std::move(element));
         return topElement;
     }
     
+    /**
+     * @brief Remove all elements in priority order
+     * 
+     * Sorts the heap in place (heapsort) and hands over its storage, so
+     * there is no per-element pop() and no reallocation.
+     * 
+     * @return Elements, highest priority first; the queue is left empty
+     */
+    std::vector<T> drainSorted() {
+        // Each step parks the current top just past the shrinking heap,
+        // which leaves the vector lowest-priority first
+        for (size_t end = heap_.size(); end > 1; --end) {
+            T last = std::move(heap_[end - 1]);
+            heap_[end - 1] = std::move(heap_[0]);
+            siftDown(0, std::move(last), end - 1);
+        }
+        std::reverse(heap_.begin(), heap_.end());
+        
+        std::vector<T> sorted = std::move(heap_);
+        heap_.clear();
+        return sorted;
+    }
+    
     /**
      * @brief View top element without removing
      * @return Reference to top element
@@ -85,53 +162,63 @@ public:
      * @brief Remove all elements
      */
     void clear() { heap_.clear(); }
+    
+    /**
+     * @brief Preallocate room for count elements
+     * @param count Expected maximum size
+     */
+    void reserve(size_t count) { heap_.reserve(count); }
 
 private:
     std::vector<T> heap_;
     Compare comp_;
     
-    void heapifyUp(size_t index) {
+    // Move the element at index up into the hole left by lower-priority parents
+    void siftUp(size_t index) {
+        T value = std::move(heap_[index]);
         while (index > 0) {
             size_t parentIdx = parent(index);
-            
-            // If current element has higher priority than parent, swap
-            if (comp_(heap_[index], heap_[parentIdx])) {
-                std::swap(heap_[index], heap_[parentIdx]);
-                index = parentIdx;
-            } else {
-                break;
-            }
+            if (!comp_(value, heap_[parentIdx])) break;
+            heap_[index] = std::move(heap_[parentIdx]);
+            index = parentIdx;
+        }
+        heap_[index] = std::move(value);
+    }
+    
+    // Sift down every internal node, last first (Floyd's heap construction)
+    void heapify() {
+        if (heap_.size() < 2) return;
+        for (size_t index = parent(heap_.size() - 1) + 1; index-- > 0;) {
+            siftDown(index, std::move(heap_[index]));
         }
     }
     
-    void heapifyDown(size_t index) {
+    // Fill the hole at index with value, pulling the best child up each
+    // level; only the first count elements are treated as the heap
+    void siftDown(size_t index, T value) {
+        siftDown(index, std::move(value), heap_.size());
+    }
+    
+    void siftDown(size_t index, T value, size_t count) {
         while (true) {
-            size_t leftIdx = leftChild(index);
-            size_t rightIdx = rightChild(index);
-            size_t smallest = index;
+            size_t first = firstChild(index);
+            if (first >= count) break;
             
-            // Find smallest among current, left, and right
-            if (leftIdx < heap_.size() && comp_(heap_[leftIdx], heap_[smallest])) {
-                smallest = leftIdx;
+            size_t last = first + Arity < count ? first + Arity : count;
+            size_t best = first;
+            for (size_t child = first + 1; child < last; ++child) {
+                if (comp_(heap_[child], heap_[best])) best = child;
             }
             
-            if (rightIdx < heap_.size() && comp_(heap_[rightIdx], heap_[smallest])) {
-                smallest = rightIdx;
-            }
-            
-            // If smallest is not current, swap and continue
-            if (smallest != index) {
-                std::swap(heap_[index], heap_[smallest]);
-                index = smallest;
-            } else {
-                break;
-            }
+            if (!comp_(heap_[best], value)) break;
+            heap_[index] = std::move(heap_[best]);
+            index = best;
         }
+        heap_[index] = std::move(value);
     }
     
-    size_t parent(size_t i) const { return (i - 1) / 2; }
-    size_t leftChild(size_t i) const { return 2 * i + 1; }
-    size_t rightChild(size_t i) const { return 2 * i + 2; }
+    static size_t parent(size_t i) { return (i - 1) / Arity; }
+    static size_t firstChild(size_t i) { return Arity * i + 1; }
 };
 
 } // namespace kinepredict
@@ -0,0 +1,91 @@
+#pragma once
+
+#include "kinepredict/data_structures/BloomFilter.h"
+#include <vector>
+#include <string>
+
+namespace kinepredict {
+
+/**
+ * @brief Auto-growing Bloom Filter that holds its target false positive rate
+ * 
+ * Starts with one BloomFilter sized for the initial estimate. When it
+ * fills up, a new sub-filter with growthFactor times the capacity and a
+ * tighter rate (tighteningRatio times the previous one) is chained on and
+ * receives all further inserts. The rates form a geometric series, so the
+ * compound false positive rate stays below the requested one no matter
+ * how far the stream overshoots the estimate.
+ * 
+ * Lookups check every sub-filter: O(k * s) for s sub-filters, where s
+ * grows only logarithmically with the number of elements.
+ */
+class ScalableBloomFilter {
+public:
+    /**
+     * @brief Construct Scalable Bloom Filter
+     * @param initialCapacity Expected number of elements for the first sub-filter
+     * @param falsePositiveRate Compound false positive bound (0.0 to 1.0)
+     * @param layout Bit layout used by every sub-filter
+     * @param growthFactor Capacity multiplier for each new sub-filter
+     * @param tighteningRatio Rate multiplier for each new sub-filter (0.0 to 1.0)
+     */
+    ScalableBloomFilter(size_t initialCapacity, double falsePositiveRate = 0.01,
+                        BloomFilter::Layout layout = BloomFilter::Layout::Standard,
+                        double growthFactor = 2.0, double tighteningRatio = 0.85);
+    
+    /**
+     * @brief Add element to filter, growing it if the current sub-filter is full
+     * @param element The string to add
+     */
+    void add(const std::string& element);
+    
+    /**
+     * @brief Check if element might be in set
+     * @param element The string to check
+     * @return true if possibly in set, false if definitely not
+     */
+    bool contains(const std::string& element) const;
+    
+    /**
+     * @brief Drop all sub-filters and start over at the initial capacity
+     */
+    void clear();
+    
+    /**
+     * @brief Get compound false positive probability
+     * @return 1 - product of (1 - rate) over all sub-filters
+     */
+    double getFalsePositiveRate() const;
+    
+    /**
+     * @brief Get memory usage in bytes
+     * @return Memory consumption of all sub-filters
+     */
+    size_t getMemoryUsage() const;
+    
+    /**
+     * @brief Get number of elements added
+     * @return Element count across all sub-filters
+     */
+    size_t getElementCount() const;
+    
+    /**
+     * @brief Get number of chained sub-filters
+     * @return Sub-filter count
+     */
+    size_t getFilterCount() const { return filters_.size(); }
+
+private:
+    std::vector<BloomFilter> filters_;
+    std::vector<size_t> capacities_;
+    size_t initialCapacity_;
+    double initialRate_;
+    double nextRate_;
+    BloomFilter::Layout layout_;
+    double growthFactor_;
+    double tighteningRatio_;
+    
+    void addFilter(size_t capacity);
+};
+
+} // namespace kinepredict
@@ -0,0 +1,137 @@
+#pragma once
+
+#include <chrono>
+#include <deque>
+#include <string_view>
+#include <vector>
+#include <cstdint>
+#include <utility>
+
+namespace kinepredict {
+
+/**
+ * @brief Bloom Filter that forgets elements older than a time window
+ *
+ * Used for rules like "reject a headline seen in the last 24h" without
+ * periodic clear() resets (and the duplicate burst that follows them).
+ *
+ * The window is split into rotating generations, each with its own plain
+ * bitmap sized for one generation's worth of inserts. add() sets bits in
+ * the current generation only; contains() ORs the live generations,
+ * newest first. When a generation falls out of the window its bitmap is
+ * cleared and reused, so expiry is exact per generation and the false
+ * positive rate stays flat on an unbounded stream. An element is
+ * remembered for at least the window length and at most one generation
+ * longer.
+ *
+ * Uses the same double-hashing scheme as BloomFilter. Each generation
+ * gets an equal share of the target false positive rate, which costs
+ * about 1.44 * log2(generations / p) bits per element in the window
+ * (~17 bits at 1% with 24 generations), less than two plain filters
+ * run side by side.
+ *
+ * remove() records the element as removed instead of clearing bits
+ * (which would hide other elements); records cost 16 bytes each and
+ * expire with the generation the element was last seen in. It is meant
+ * for occasional corrections, not bulk deletion.
+ *
+ * Time Complexity: O(k * generations) contains worst case, O(k) add,
+ * O(m / generations) per generation rotation
+ */
+class SlidingWindowBloomFilter {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * @brief Construct Sliding Window Bloom Filter
+     * @param window How long an element is remembered
+     * @param expectedPerSecond Expected insert rate
+     * @param falsePositiveRate Desired false positive rate (0.0 to 1.0)
+     * @param generations Number of generations the window is split into
+     * @param start Start of the first generation
+     */
+    SlidingWindowBloomFilter(Clock::duration window, double expectedPerSecond,
+                             double falsePositiveRate = 0.01, size_t generations = 24,
+                             Clock::time_point start = Clock::now());
+
+    /**
+     * @brief Expire old generations, then add element
+     *
+     * Adding an element also cancels an earlier remove() of it.
+     *
+     * @param element The string to add
+     * @param now Current time
+     */
+    void add(std::string_view element, Clock::time_point now = Clock::now());
+
+    /**
+     * @brief Check if element might have been added within the window
+     *
+     * Reflects the state as of the last add() or advance().
+     *
+     * @param element The string to check
+     * @return true if possibly in window, false if definitely not
+     */
+    bool contains(std::string_view element) const;
+
+    /**
+     * @brief Hide element until it is added again or expires
+     * @param element The string to remove
+     * @return true if the element was possibly in the window
+     */
+    bool remove(std::string_view element);
+
+    /**
+     * @brief Rotate generations and expire everything older than the window
+     * @param now Current time
+     */
+    void advance(Clock::time_point now = Clock::now());
+
+    /**
+     * @brief Clear all data
+     * @param now Start of the new first generation
+     */
+    void clear(Clock::time_point now = Clock::now());
+
+    /**
+     * @brief Get number of elements currently in the window
+     * @return Element count (insertions minus removals)
+     */
+    size_t getElementCount() const;
+
+    /**
+     * @brief Get false positive probability
+     * @return Current estimated false positive rate over the live generations
+     */
+    double getFalsePositiveRate() const;
+
+    /**
+     * @brief Get memory usage in bytes
+     * @return Memory consumption (generation bitmaps plus removal records)
+     */
+    size_t getMemoryUsage() const;
+
+private:
+    struct Generation {
+        Clock::time_point start;
+        size_t slot;                // Bitmap index in bits_
+        size_t count;               // Elements added minus removed
+        std::vector<std::pair<uint64_t, uint64_t>> removed;
+    };
+
+    std::vector<uint64_t> bits_;      // numSlots_ bitmaps of wordsPerGeneration_ words
+    std::deque<Generation> generations_;
+    Clock::duration window_;
+    Clock::duration generationLength_;
+    size_t numSlots_;                 // Most generations live at once
+    size_t numHashFunctions_;
+    size_t bitsPerGeneration_;
+    size_t wordsPerGeneration_;
+    size_t removedCount_;
+
+    bool testBits(size_t slot, uint64_t h1, uint64_t h2) const;
+    bool isRemoved(uint64_t h1, uint64_t h2) const;
+    void startGeneration(Clock::time_point start);
+};
+
+} // namespace kinepredict
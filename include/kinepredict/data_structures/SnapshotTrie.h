@@ -0,0 +1,154 @@
+#pragma once
+
+#include "kinepredict/data_structures/Trie.h"
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <cstdint>
+
+namespace kinepredict {
+
+/**
+ * @brief Read-mostly Trie that is replaced wholesale while being queried
+ * 
+ * Used for:
+ * - Keyword dictionaries reloaded hourly under live API traffic
+ * 
+ * Reloads build a complete Trie off to the side and publish() it with
+ * one atomic pointer swap, so readers see either the old or the new
+ * dictionary, never a half-built one. Readers take no lock: they announce
+ * themselves in a per-epoch counter shard (two parities, cache-line
+ * padded), load the pointer and query. publish() bumps the epoch, waits
+ * for readers still announced under the previous parity to leave, and
+ * only then frees the old trie. Readers never wait for a writer; writers
+ * are serialized and wait only for in-flight reads.
+ * 
+ * Time Complexity:
+ * - Reads: the underlying Trie operation plus two atomic increments
+ * - Publish: O(readers in flight) wait, plus O(slabs) to free the old trie
+ */
+class SnapshotTrie {
+public:
+    SnapshotTrie();
+    
+    /**
+     * @brief Start from an already-built dictionary
+     * @param initial Trie to publish as the first snapshot
+     */
+    explicit SnapshotTrie(Trie initial);
+    ~SnapshotTrie();
+    
+    SnapshotTrie(const SnapshotTrie&) = delete;
+    SnapshotTrie& operator=(const SnapshotTrie&) = delete;
+    
+    /**
+     * @brief Replace the dictionary (thread-safe)
+     * 
+     * Returns after the previous snapshot has no readers left and has
+     * been freed.
+     * 
+     * @param next Fully built trie to publish
+     */
+    void publish(Trie next);
+    
+    /**
+     * @brief Run a read-only query against one consistent snapshot
+     * 
+     * The trie reference (and anything borrowing it, such as a
+     * Trie::Completions cursor) must not escape the callback.
+     * 
+     * @param query Callable taking const Trie&
+     * @return Whatever query returns
+     */
+    template<typename Query>
+    auto read(Query&& query) const {
+        ReadGuard guard(*this);
+        return query(*guard.trie);
+    }
+    
+    /**
+     * @brief Search for exact word match (thread-safe)
+     * @param word The word to search for
+     * @return true if word exists in the current snapshot
+     */
+    bool search(const std::string& word) const;
+    
+    /**
+     * @brief Check if any word starts with given prefix (thread-safe)
+     * @param prefix The prefix to check
+     * @return true if prefix exists in the current snapshot
+     */
+    bool startsWith(const std::string& prefix) const;
+    
+    /**
+     * @brief Get all words with given prefix (thread-safe)
+     * @param prefix The prefix
+     * @return Vector of words matching prefix
+     */
+    std::vector<std::string> getWordsWithPrefix(const std::string& prefix) const;
+    
+    /**
+     * @brief Get the k highest-weighted words with given prefix (thread-safe)
+     * @param prefix The prefix
+     * @param k Maximum number of results
+     * @return Completions, best weight first
+     */
+    std::vector<Trie::Completion> topK(const std::string& prefix, size_t k) const;
+    
+    /**
+     * @brief Get number of words in the current snapshot
+     * @return Word count
+     */
+    size_t size() const;
+    
+    /**
+     * @brief Get number of snapshots published after the first
+     * @return Publish count
+     */
+    uint64_t getVersion() const;
+
+private:
+    static constexpr size_t kReaderShards = 16;
+
+    struct alignas(64) ReaderShard {
+        std::atomic<size_t> active{0};
+    };
+
+    // Announces a reader for the lifetime of one query
+    class ReadGuard {
+    public:
+        explicit ReadGuard(const SnapshotTrie& owner) {
+            size_t shard = readerShard();
+            while (true) {
+                uint64_t epoch = owner.epoch_.load();
+                slot_ = &owner.readers_[epoch & 1][shard].active;
+                slot_->fetch_add(1);
+                // If a publish slipped in, the writer may already have
+                // drained this parity; back out and announce again
+                if (owner.epoch_.load() == epoch) break;
+                slot_->fetch_sub(1);
+            }
+            trie = owner.current_.load();
+        }
+        ~ReadGuard() { slot_->fetch_sub(1, std::memory_order_release); }
+        
+        ReadGuard(const ReadGuard&) = delete;
+        ReadGuard& operator=(const ReadGuard&) = delete;
+        
+        const Trie* trie;
+        
+    private:
+        std::atomic<size_t>* slot_;
+    };
+
+    std::atomic<Trie*> current_;
+    std::atomic<uint64_t> epoch_;
+    mutable ReaderShard readers_[2][kReaderShards];
+    std::mutex publishMutex_;
+    
+    // Shard used by the calling thread
+    static size_t readerShard();
+};
+
+} // namespace kinepredict
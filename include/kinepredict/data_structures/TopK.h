@@ -0,0 +1,129 @@
+#pragma once
+
+#include "kinepredict/data_structures/PriorityQueue.h"
+#include <vector>
+#include <functional>
+#include <stdexcept>
+#include <algorithm>
+
+namespace kinepredict {
+
+/**
+ * @brief Bounded collector that keeps the best K of a stream
+ * 
+ * Used for:
+ * - /batch ranking: best K of N scored variations
+ * - Per-thread partial rankings before a merge
+ * 
+ * Compare has the same meaning as for PriorityQueue: comp(a, b) is true
+ * if a ranks ahead of b. Internally a PriorityQueue with the comparator
+ * reversed keeps the worst retained element on top. Once full, a
+ * candidate that can't beat it is rejected with a single compare, and
+ * one that can replaces it in a single sift. Memory stays at K elements.
+ * 
+ * Time Complexity:
+ * - Offer: O(1) reject, O(d log_d K) accept
+ * - DrainSorted: O(K log K)
+ */
+template<typename T, typename Compare = std::less<T>, size_t Arity = 4>
+class TopK {
+public:
+    /**
+     * @brief Construct an empty collector
+     * @param k Number of elements to keep (must be positive)
+     * @param comp Returns true if its first argument ranks ahead
+     */
+    explicit TopK(size_t k, const Compare& comp = Compare())
+    : k_(k), comp_(comp), heap_(Reversed{comp}) {
+        if (k == 0) {
+            throw std::invalid_argument("TopK capacity must be positive");
+        }
+        heap_.reserve(k);
+    }
+    
+    /**
+     * @brief Consider an element for the top K
+     * @param element Candidate
+     * @return true if the element was kept
+     */
+    bool offer(const T& element) {
+        if (heap_.size() < k_) {
+            heap_.push(element);
+            return true;
+        }
+        if (!comp_(element, heap_.top())) {
+            return false;
+        }
+        heap_.replaceTop(element);
+        return true;
+    }
+    
+    bool offer(T&& element) {
+        if (heap_.size() < k_) {
+            heap_.push(std::move(element));
+            return true;
+        }
+        if (!comp_(element, heap_.top())) {
+            return false;
+        }
+        heap_.replaceTop(std::move(element));
+        return true;
+    }
+    
+    /**
+     * @brief View the lowest-ranked retained element (the admission bar)
+     * @return Reference to the K-th best element seen so far
+     */
+    const T& worst() const { return heap_.top(); }
+    
+    /**
+     * @brief Remove the retained elements in rank order
+     * @return Up to K elements, best first; the collector is left empty
+     */
+    std::vector<T> drainSorted() {
+        std::vector<T> sorted = heap_.drainSorted();
+        std::reverse(sorted.begin(), sorted.end());
+        return sorted;
+    }
+    
+    /**
+     * @brief Get number of retained elements
+     * @return Size, at most capacity()
+     */
+    size_t size() const { return heap_.size(); }
+    
+    /**
+     * @brief Get K
+     * @return Maximum number of retained elements
+     */
+    size_t capacity() const { return k_; }
+    
+    /**
+     * @brief Check whether K elements are retained
+     * @return true if offers now have to beat worst()
+     */
+    bool full() const { return heap_.size() == k_; }
+    
+    /**
+     * @brief Check if nothing is retained
+     * @return true if empty
+     */
+    bool empty() const { return heap_.empty(); }
+    
+    /**
+     * @brief Remove all elements
+     */
+    void clear() { heap_.clear(); }
+
+private:
+    struct Reversed {
+        Compare comp;
+        bool operator()(const T& a, const T& b) const { return comp(b, a); }
+    };
+    
+    size_t k_;
+    Compare comp_;
+    PriorityQueue<T, Reversed, Arity> heap_;
+};
+
+} // namespace kinepredict
@@ -2,11 +2,18 @@
 
 #include <string>
 #include <memory>
+#include <memory_resource>
 #include <vector>
-#include <unordered_map>
+#include <optional>
+#include <limits>
+#include <cstdint>
+#include "kinepredict/data_structures/PriorityQueue.h"
 
 namespace kinepredict {
 
+class FrozenTrie;
+class AhoCorasick;
+
 /**
  * @brief Trie (Prefix Tree) for efficient keyword matching and autocomplete
  * 
@@ -15,22 +22,118 @@ namespace kinepredict {
  * - SEO keyword matching
  * - Pattern detection
  * 
+ * Nodes are allocated from contiguous slabs of kSlabSize nodes and refer
+ * to each other by index. Each node's children live in one small block
+ * (sorted labels followed by child indices) carved from arena chunks, so
+ * a lookup step scans one cache line of labels. clear() and the
+ * destructor free whole slabs and chunks, so tearing down millions of
+ * words costs a few hundred deallocations and never recurses. Memory
+ * comes from a std::pmr::memory_resource, which may be supplied by the
+ * caller (e.g. a monotonic arena released wholesale).
+ * 
+ * Words may carry a weight, and every node caches the best weight in its
+ * subtree. Scored autocomplete (topK, completions) walks best-first on
+ * those bounds and only visits the branches that can still win.
+ * 
  * Time Complexity:
  * - Insert: O(m) where m is key length
  * - Search: O(m)
  * - StartsWith: O(m)
+ * - TopK: O(m + k * d * log(k * d)) for completion depth d
+ * - FuzzySearch: O(visited nodes * maxEdits)
  */
 class Trie {
+    struct TrieNode;
+
 public:
+    struct Completion {
+        std::string word;
+        float weight;
+    };
+    
+    struct FuzzyMatch {
+        std::string word;
+        size_t distance;   // Levenshtein distance to the query
+    };
+    
+    /**
+     * @brief Lazy cursor over the completions of a prefix, best weight first
+     * 
+     * Each next() expands only as much of the trie as needed to prove the
+     * next result, so pages can be fetched on demand. The cursor borrows
+     * the trie: inserting into, clearing or destroying it invalidates the
+     * cursor. Equal weights come out in unspecified order.
+     */
+    class Completions {
+    public:
+        /**
+         * @brief Get the next highest-weighted completion
+         * @return Completion, or std::nullopt when exhausted
+         */
+        std::optional<Completion> next();
+        
+    private:
+        friend class Trie;
+        
+        struct Entry {
+            float score;       // Word weight, or subtree bound
+            uint32_t node;
+            uint32_t step;     // Index into steps_ spelling this node
+            bool isWord;
+        };
+        
+        struct HigherScore {
+            // Words before subtrees on ties, so results come out without extra expansion
+            bool operator()(const Entry& a, const Entry& b) const {
+                return a.score > b.score || (a.score == b.score && a.isWord && !b.isWord);
+            }
+        };
+        
+        struct Step {
+            uint32_t parent;
+            char label;
+        };
+        
+        Completions(const Trie& trie, const std::string& prefix, uint32_t start);
+        
+        const Trie* trie_;
+        std::string prefix_;
+        std::vector<Step> steps_;   // Parent-linked labels back to the prefix node
+        PriorityQueue<Entry, HigherScore> frontier_;
+    };
+    
     Trie();
+    
+    /**
+     * @brief Construct a trie whose node slabs come from resource
+     * @param resource Memory resource; must outlive the trie
+     */
+    explicit Trie(std::pmr::memory_resource* resource);
     ~Trie();
     
+    Trie(const Trie&) = delete;
+    Trie& operator=(const Trie&) = delete;
+    
+    // A moved-from trie may only be assigned to, cleared or destroyed
+    Trie(Trie&& other) noexcept;
+    Trie& operator=(Trie&& other) noexcept;
+    
     /**
      * @brief Insert a word into the trie
+     * 
+     * New words get weight 0; an existing word keeps its weight.
+     * 
      * @param word The word to insert
      */
     void insert(const std::string& word);
     
+    /**
+     * @brief Insert a word, or update its weight if already present
+     * @param word The word to insert
+     * @param weight Score used to rank completions (higher is better)
+     */
+    void insert(const std::string& word, float weight);
+    
     /**
      * @brief Search for exact word match
      * @param word The word to search for
@@ -52,8 +155,41 @@ public:
      */
     std::vector<std::string> getWordsWithPrefix(const std::string& prefix) const;
     
+    /**
+     * @brief Get the k highest-weighted words with given prefix
+     * @param prefix The prefix
+     * @param k Maximum number of results
+     * @return Completions, best weight first
+     */
+    std::vector<Completion> topK(const std::string& prefix, size_t k) const;
+    
+    /**
+     * @brief Iterate completions of a prefix lazily, best weight first
+     * @param prefix The prefix
+     * @return Cursor over the completions (empty if prefix not found)
+     */
+    Completions completions(const std::string& prefix) const;
+    
+    /**
+     * @brief Find words within an edit distance of a (misspelled) word
+     * 
+     * Walks the trie depth-first keeping one Levenshtein DP row per
+     * level, restricted to the diagonal band of width 2 * maxEdits + 1,
+     * and prunes a subtree as soon as every cell of its row exceeds
+     * maxEdits.
+     * 
+     * @param word The word to match
+     * @param maxEdits Maximum insertions, deletions and substitutions;
+     *        any value (up to SIZE_MAX) at or above the longest possible
+     *        distance matches every word
+     * @return Matches sorted by distance, then word
+     */
+    std::vector<FuzzyMatch> fuzzySearch(const std::string& word, size_t maxEdits) const;
+    
     /**
      * @brief Clear all data from trie
+     * 
+     * Releases every slab at once: O(slabs), not O(nodes).
      */
     void clear();
     
@@ -62,21 +198,69 @@ public:
      * @return Word count
      */
     size_t size() const;
+    
+    /**
+     * @brief Get approximate heap memory used by the nodes
+     * @return Memory consumption in bytes
+     */
+    size_t getMemoryUsage() const;
+    
+    /**
+     * @brief Build an immutable, compact copy for read-only dictionaries
+     * @return Double-array trie with the same words
+     */
+    FrozenTrie freeze() const;
 
 private:
+    static constexpr uint32_t kNoNode = UINT32_MAX;
+    static constexpr uint32_t kRoot = 0;
+    static constexpr size_t kSlabShift = 12;
+    static constexpr size_t kSlabSize = size_t(1) << kSlabShift;   // Nodes per slab
+    static constexpr size_t kChunkBytes = 64 * 1024;                // Child-block arena chunk
+    static constexpr size_t kBlockClasses = 9;                      // Capacities 1, 2, 4 ... 256
+    static constexpr float kNoWeight = -std::numeric_limits<float>::infinity();
+
     struct TrieNode {
-        std::unordered_map<char, std::unique_ptr<TrieNode>> children;
+        unsigned char* children;   // capacity labels, then capacity uint32_t indices
+        uint16_t childCount;
+        uint8_t capacityClass;
+        char label;
         bool isEndOfWord;
-        
-        TrieNode() : isEndOfWord(false) {}
+        float weight;              // Meaningful when isEndOfWord
+        float bestWeight;          // Max weight of any word in this subtree
     };
     
-    std::unique_ptr<TrieNode> root_;
+    std::pmr::memory_resource* resource_;
+    std::vector<TrieNode*> slabs_;
+    std::vector<unsigned char*> chunks_;
+    std::vector<unsigned char*> freeBlocks_[kBlockClasses];   // Outgrown blocks, reused by class
+    unsigned char* chunkCursor_;
+    size_t chunkRemaining_;
+    uint32_t nodeCount_;
     size_t wordCount_;
+    size_t longestWord_;           // Longest word inserted since clear() (fuzzySearch bound)
+    std::vector<uint32_t> path_;   // Insert scratch: nodes from the root to the word
+    
+    TrieNode& node(uint32_t index) { return slabs_[index >> kSlabShift][index & (kSlabSize - 1)]; }
+    const TrieNode& node(uint32_t index) const { return slabs_[index >> kSlabShift][index & (kSlabSize - 1)]; }
+    
+    static size_t blockCapacity(uint8_t capacityClass) { return size_t(1) << capacityClass; }
+    static size_t blockBytes(uint8_t capacityClass);
+    static uint32_t* childIndices(const TrieNode& node) {
+        return reinterpret_cast<uint32_t*>(node.children + ((blockCapacity(node.capacityClass) + 3) & ~size_t(3)));
+    }
+    
+    uint32_t newNode(char label);
+    uint32_t findChild(uint32_t parent, char label) const;
+    uint32_t addChild(uint32_t parent, char label);
+    uint32_t findNode(const std::string& key) const;
+    void insertWord(const std::string& word, float weight, bool setWeight);
+    void updateBestWeights(float oldWeight, float newWeight);
+    unsigned char* allocateBlock(uint8_t capacityClass);
+    void releaseMemory();
     
-    // Helper for getWordsWithPrefix
-    void collectWords(const TrieNode* node, const std::string& prefix, 
-                      std::vector<std::string>& results) const;
+    friend class FrozenTrie;
+    friend class AhoCorasick;
 };
 
 } // namespace kinepredict
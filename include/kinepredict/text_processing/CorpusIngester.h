@@ -0,0 +1,109 @@
+#pragma once
+
+#include "kinepredict/data_structures/ConcurrentBloomFilter.h"
+#include "kinepredict/data_structures/Trie.h"
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace kinepredict {
+
+/**
+ * @brief Counters and timing for one ingestion run
+ *
+ * Every line is exactly one of unique, duplicate or blank (nothing left
+ * after normalization).
+ */
+struct IngestStats {
+    size_t bytes = 0;
+    size_t lines = 0;
+    size_t uniqueLines = 0;
+    size_t duplicateLines = 0;
+    size_t blankLines = 0;
+    size_t keywords = 0;        // Tokens of unique lines (indexed into the trie)
+    double seconds = 0.0;
+
+    double megabytesPerSecond() const { return seconds > 0 ? bytes / seconds / 1e6 : 0.0; }
+    double linesPerSecond() const { return seconds > 0 ? lines / seconds : 0.0; }
+};
+
+/**
+ * @brief Bulk loader for newline-delimited headline corpora
+ *
+ * Splits the input into fixed-size chunks that worker threads claim one
+ * at a time. A chunk owns every line that starts inside it, so chunks are
+ * aligned to line boundaries without a sequential pre-pass. Lines are
+ * found with a SIMD newline scan and handled as views into the input.
+ *
+ * Each line is normalized (TextProcessor::normalize) and deduplicated on
+ * its normalized form through the shared ConcurrentBloomFilter. The
+ * tokens of first-seen lines are inserted into the Trie in per-thread
+ * batches, so the trie mutex is taken once per batch rather than once
+ * per word, and a small per-thread cache skips keywords the worker has
+ * already queued. A trailing '\r' is treated as part of the line
+ * terminator.
+ *
+ * Deduplication is as approximate as the filter: besides false
+ * positives, two workers that meet copies of the same line at the same
+ * moment may both count it as unique (its keywords are then indexed
+ * twice, which is harmless).
+ *
+ * Files are memory-mapped and read with sequential read-ahead; chunks are
+ * released once processed, so inputs larger than RAM stream through.
+ *
+ * The trie must not be used by other threads while a run is in progress.
+ */
+class CorpusIngester {
+public:
+    /** @brief Default bytes per chunk handed to a worker */
+    static constexpr size_t kDefaultChunkBytes = size_t(4) << 20;
+
+    /**
+     * @brief Construct an ingester feeding existing structures
+     * @param dedup Filter of already-seen normalized lines
+     * @param keywords Trie receiving the tokens of new lines
+     * @param numThreads Worker threads (0 means hardware concurrency)
+     * @param chunkBytes Bytes per work unit
+     * @throws std::invalid_argument if chunkBytes is 0
+     */
+    CorpusIngester(ConcurrentBloomFilter& dedup, Trie& keywords,
+                   size_t numThreads = 0, size_t chunkBytes = kDefaultChunkBytes);
+
+    /**
+     * @brief Ingest a newline-delimited file
+     * @param path File to map
+     * @return Counters and timing for the run
+     * @throws std::runtime_error if the file can't be opened or mapped
+     */
+    IngestStats ingestFile(const std::string& path);
+
+    /**
+     * @brief Ingest newline-delimited text already in memory
+     * @param corpus Input text
+     * @return Counters and timing for the run
+     */
+    IngestStats ingest(std::string_view corpus);
+
+    /**
+     * @brief Split text into lines without copying (SIMD newline scan)
+     * @param text Input text; the views point into it
+     * @param lines Output buffer, cleared first; a final line without a
+     *        terminator is included, '\r' before '\n' is stripped
+     */
+    static void splitLines(std::string_view text, std::vector<std::string_view>& lines);
+
+private:
+    ConcurrentBloomFilter& dedup_;
+    Trie& keywords_;
+    std::mutex keywordsMutex_;
+    size_t numThreads_;
+    size_t chunkBytes_;
+
+    // Shared by ingest and ingestFile; onChunkDone(begin, end) is called
+    // after a chunk's byte range has been fully read
+    template<typename OnChunkDone>
+    IngestStats run(std::string_view corpus, OnChunkDone onChunkDone);
+};
+
+} // namespace kinepredict
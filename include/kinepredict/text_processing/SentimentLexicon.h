@@ -0,0 +1,146 @@
+#pragma once
+
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+namespace kinepredict {
+
+/**
+ * @brief One lexicon word and its score
+ *
+ * Negators ("not", "never", "don't") flip the sign of the scored words
+ * that follow them; their own score is ignored.
+ */
+struct LexiconEntry {
+    std::string_view word;
+    float score;
+    bool negator = false;
+};
+
+/**
+ * @brief Result of scoring a token sequence
+ */
+struct SentimentScore {
+    double score = 0.0;       // Sum of matched word scores, after negation
+    size_t positive = 0;      // Matched words that contributed a positive score
+    size_t negative = 0;      // Matched words that contributed a negative score
+    size_t tokens = 0;
+
+    /** @brief Score per token, comparable across texts of different lengths */
+    double comparative() const { return tokens > 0 ? score / tokens : 0.0; }
+};
+
+/**
+ * @brief Word-to-score lexicon compiled into a minimal perfect hash
+ *
+ * Used for:
+ * - Sentiment scoring of headlines as a single O(n) pass over the tokens
+ *   from TextProcessor::normalize
+ *
+ * Words are placed with hash-and-displace (CHD): keys are hashed once
+ * with hash64(), grouped into buckets of about kBucketSize, and each
+ * bucket, largest first, is given the smallest displacement that sends
+ * all its keys to free slots. The table has exactly one slot per word,
+ * so a lookup is one hash, one displacement read and one slot read; the
+ * slot's word is compared to reject tokens outside the lexicon. Word
+ * bytes live in one contiguous buffer and lookups never allocate.
+ *
+ * Negation: after a negator, the scores of the next negationWindow tokens
+ * are negated. Negators share the table with scored words, so one lookup
+ * per token handles both.
+ *
+ * Time Complexity: O(n) expected build, O(1) lookup
+ * Space Complexity: O(n) for n words
+ */
+class SentimentLexicon {
+public:
+    /** @brief Keys per displacement bucket on average */
+    static constexpr size_t kBucketSize = 4;
+
+    static constexpr size_t kDefaultNegationWindow = 3;
+
+    /**
+     * @brief Reusable buffers for score(text)
+     */
+    struct Scratch {
+        std::string buffer;
+        std::vector<std::string_view> tokens;
+    };
+
+    /**
+     * @brief Compile a custom lexicon
+     * @param entries Words (normalized with TextProcessor::normalize) and scores
+     * @param negationWindow Tokens after a negator whose scores are negated
+     * @throws std::invalid_argument if a word is not a single token or is
+     *         listed twice
+     */
+    explicit SentimentLexicon(const std::vector<LexiconEntry>& entries,
+                              size_t negationWindow = kDefaultNegationWindow);
+
+    /**
+     * @brief Get the built-in English lexicon
+     *
+     * The word list is a constexpr table; it is compiled into the perfect
+     * hash on first use (thread-safe).
+     *
+     * @return Shared lexicon with the default negation window
+     */
+    static const SentimentLexicon& builtin();
+
+    /**
+     * @brief Look up a word
+     * @param word Normalized token
+     * @return Score, or nullopt for unknown words and negators
+     */
+    std::optional<float> find(std::string_view word) const;
+
+    /**
+     * @brief Check whether a word is a negator
+     * @param word Normalized token
+     * @return true if the word negates what follows it
+     */
+    bool isNegator(std::string_view word) const;
+
+    /**
+     * @brief Score normalized tokens in a single pass
+     * @param tokens Tokens from TextProcessor::normalize
+     * @return Summed score and counts
+     */
+    SentimentScore score(const std::vector<std::string_view>& tokens) const;
+
+    /**
+     * @brief Normalize and score text
+     * @param text Input text
+     * @param scratch Caller-owned buffers (reuse to avoid allocation)
+     * @return Summed score and counts
+     */
+    SentimentScore score(std::string_view text, Scratch& scratch) const;
+
+    size_t size() const { return slots_.size(); }
+    size_t negationWindow() const { return negationWindow_; }
+
+private:
+    static constexpr uint32_t kNotFound = UINT32_MAX;
+
+    struct Slot {
+        float score;
+        uint32_t offset;    // Word bytes in words_
+        uint16_t length;
+        bool negator;
+    };
+
+    uint64_t seed_;
+    size_t negationWindow_;
+    std::vector<uint32_t> displacements_;   // One per bucket
+    std::vector<Slot> slots_;
+    std::string words_;
+
+    uint32_t lookup(std::string_view word) const;
+    uint32_t slotOf(uint64_t hash) const;
+};
+
+} // namespace kinepredict
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <string>
 #include <vector>
 #include <string_view>
@@ -8,26 +9,65 @@ namespace kinepredict {
 
 /**
  * @brief Text processing utilities for marketing content analysis
+ * 
+ * Tokens are maximal runs of word characters: ASCII letters and digits
+ * plus any non-ASCII code point except Unicode spaces, Latin-1 symbols
+ * and general/CJK punctuation. An apostrophe (' or U+2019) between two
+ * word characters stays inside the token ("don't"). Everything else,
+ * including malformed UTF-8, separates tokens. ASCII is classified by a
+ * 256-entry table; only non-ASCII bytes are decoded.
  */
 class TextProcessor {
 public:
     /**
-     * @brief Tokenize text into words
-     * @param text Input text
-     * @return Vector of tokens
+     * @brief Tokenize text into words without copying
+     * @param text Input text; the views point into it and must not outlive it
+     * @param tokens Output buffer, cleared first (reuse it across calls)
+     */
+    static void tokenize(std::string_view text, std::vector<std::string_view>& tokens);
+    
+    /**
+     * @brief Tokenize text into words without copying
+     * @param text Input text; the views point into it and must not outlive it
+     * @return Vector of token views
+     */
+    static std::vector<std::string_view> tokenize(std::string_view text);
+    
+    /**
+     * @brief Lowercase, strip punctuation and tokenize in a single pass
+     * 
+     * Equivalent to tokenize(removePunctuation(toLowerCase(text))) with
+     * U+2019 folded to ', but without intermediate copies. Runs of ASCII
+     * letters and digits are classified and lowercased 32 (AVX2) or 16
+     * (SSE2) bytes at a time; other characters take the UTF-8 path.
+     * 
+     * @param text Input text (UTF-8)
+     * @param buffer Caller-owned output: the tokens joined by single spaces
+     * @param tokens Output views into buffer, cleared first; valid until
+     *        buffer is next modified
      */
-    static std::vector<std::string> tokenize(std::string_view text);
+    static void normalize(std::string_view text, std::string& buffer,
+                          std::vector<std::string_view>& tokens);
     
     /**
      * @brief Convert text to lowercase
-     * @param text Input text
+     * 
+     * ASCII, Latin-1, Latin Extended-A, Greek and Cyrillic letters are
+     * mapped; other characters and malformed bytes are copied unchanged.
+     * 
+     * @param text Input text (UTF-8)
      * @return Lowercase version
      */
     static std::string toLowerCase(std::string_view text);
     
     /**
      * @brief Remove punctuation from text
-     * @param text Input text
+     * 
+     * Keeps word characters, whitespace and in-word apostrophes; drops
+     * punctuation, symbols and malformed bytes. Dropped characters that
+     * separate two words become a single space ("buy.now" -> "buy now").
+     * 
+     * @param text Input text (UTF-8)
      * @return Text without punctuation
      */
     static std::string removePunctuation(std::string_view text);
@@ -36,13 +76,52 @@ public:
      * @brief Extract n-grams from tokens
      * @param tokens Input tokens
      * @param n N-gram size (1=unigram, 2=bigram, etc.)
-     * @return Vector of n-grams
+     * @return Vector of n-grams, tokens joined by single spaces
      */
     static std::vector<std::string> extractNGrams(
-        const std::vector<std::string>& tokens, size_t n);
+        const std::vector<std::string_view>& tokens, size_t n);
+    
+    /** @brief Largest n accepted by hashNGrams */
+    static constexpr size_t kMaxHashedNGram = 8;
     
     /**
-     * @brief Calculate word count
+     * @brief Hash every n-gram of length minN..maxN in one sweep
+     * 
+     * Each token is hashed once; longer grams are rolled from shorter ones
+     * with hashCombine, so no n-gram string is ever built. IDs depend only
+     * on the gram's tokens (not its position) and are emitted by end token,
+     * shortest gram first. The IDs can be fed to BloomFilter::addHashed or
+     * used as feature-hashing keys.
+     * 
+     * @param tokens Input tokens
+     * @param minN Shortest gram (>= 1)
+     * @param maxN Longest gram (minN..kMaxHashedNGram)
+     * @param ids Output buffer, cleared first (reuse it across calls)
+     * @throws std::invalid_argument if the range is empty or maxN is too large
+     */
+    static void hashNGrams(const std::vector<std::string_view>& tokens,
+                           size_t minN, size_t maxN, std::vector<uint64_t>& ids);
+    
+    /**
+     * @brief Hash every n-gram of length minN..maxN into a fixed bucket range
+     * 
+     * Same grams and order as hashNGrams, with each ID reduced to
+     * [0, numBuckets) for fixed-width feature vectors.
+     * 
+     * @param tokens Input tokens
+     * @param minN Shortest gram (>= 1)
+     * @param maxN Longest gram (minN..kMaxHashedNGram)
+     * @param numBuckets Number of buckets (> 0)
+     * @param buckets Output buffer, cleared first (reuse it across calls)
+     * @throws std::invalid_argument if the range is empty, maxN is too large
+     *         or numBuckets is 0
+     */
+    static void hashNGrams(const std::vector<std::string_view>& tokens,
+                           size_t minN, size_t maxN, uint32_t numBuckets,
+                           std::vector<uint32_t>& buckets);
+    
+    /**
+     * @brief Calculate word count (same rules as tokenize, no allocation)
      * @param text Input text
      * @return Number of words
      */
@@ -50,8 +129,8 @@ public:
     
     /**
      * @brief Calculate character count (excluding spaces)
-     * @param text Input text
-     * @return Number of characters
+     * @param text Input text (UTF-8)
+     * @return Number of code points that are not whitespace
      */
     static size_t charCount(std::string_view text);
 };
@@ -0,0 +1,138 @@
+#pragma once
+
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+namespace kinepredict {
+
+/**
+ * @brief Compressed sparse row matrix of TF-IDF vectors
+ *
+ * Row r's non-zeros are indices[rowOffsets[r] .. rowOffsets[r + 1]) with
+ * matching values, column indices ascending.
+ */
+struct SparseMatrix {
+    size_t numColumns = 0;
+    std::vector<size_t> rowOffsets{0};
+    std::vector<uint32_t> indices;
+    std::vector<float> values;
+
+    size_t rows() const { return rowOffsets.size() - 1; }
+    size_t nonZeros() const { return indices.size(); }
+};
+
+/**
+ * @brief TF-IDF features over hashed word n-grams
+ *
+ * Terms are the 1..maxNGram word n-grams of the normalized text, identified
+ * by their TextProcessor::hashNGrams IDs, so no term string is stored or
+ * built. fit() counts document frequencies on worker threads into
+ * thread-local tables split into hash partitions; each partition is then
+ * merged by one thread. The surviving terms are frozen into a vocabulary
+ * that maps term hashes to dense column IDs through an open-addressing
+ * table, ordered by descending document frequency.
+ *
+ * Vectors hold raw term counts times smoothed IDF, ln((1 + n) / (1 + df)) + 1,
+ * and are L2-normalized. Terms outside the vocabulary are ignored.
+ *
+ * Time Complexity: O(total tokens * maxNGram) fit and transform
+ * Space Complexity: O(V) for V vocabulary terms
+ */
+class TfidfVectorizer {
+public:
+    /**
+     * @brief Reusable buffers for single-document transform()
+     *
+     * Keep one per thread; once the buffers have grown to fit the longest
+     * document, transforms allocate nothing.
+     */
+    struct Scratch {
+        std::string buffer;
+        std::vector<std::string_view> tokens;
+        std::vector<uint64_t> terms;
+        std::vector<uint32_t> columns;
+    };
+
+    /**
+     * @brief Construct an unfitted vectorizer
+     * @param maxNGram Longest word n-gram used as a term
+     * @param minDocumentFrequency Drop terms seen in fewer documents
+     * @param maxFeatures Keep at most this many terms, most frequent first (0 = all)
+     * @throws std::invalid_argument if maxNGram is out of range
+     */
+    explicit TfidfVectorizer(size_t maxNGram = 1, size_t minDocumentFrequency = 1, size_t maxFeatures = 0);
+
+    /**
+     * @brief Learn the vocabulary and IDF weights, replacing any previous fit
+     * @param documents Training documents
+     * @param numThreads Worker threads (0 means hardware concurrency)
+     */
+    void fit(const std::vector<std::string_view>& documents, size_t numThreads = 0);
+
+    /**
+     * @brief Vectorize one document
+     * @param text Input text
+     * @param scratch Caller-owned buffers
+     * @param columns Output column IDs, cleared first, ascending
+     * @param values Output weights matching columns
+     */
+    void transform(std::string_view text, Scratch& scratch,
+                   std::vector<uint32_t>& columns, std::vector<float>& values) const;
+
+    /**
+     * @brief Vectorize a batch of documents
+     * @param documents Input documents
+     * @param numThreads Worker threads (0 means hardware concurrency)
+     * @return One CSR row per document
+     */
+    SparseMatrix transform(const std::vector<std::string_view>& documents, size_t numThreads = 0) const;
+
+    /**
+     * @brief Look up the column of a term
+     * @param term Term text; normalized and tokenized like documents
+     * @return Column ID, or nullopt if the term is not in the vocabulary
+     */
+    std::optional<uint32_t> termColumn(std::string_view term) const;
+
+    /**
+     * @brief Get the IDF weight of a column
+     * @param column Column ID
+     * @return Smoothed inverse document frequency
+     */
+    float idf(uint32_t column) const { return idf_[column]; }
+
+    /**
+     * @brief Get the document frequency of a column
+     * @param column Column ID
+     * @return Number of training documents containing the term
+     */
+    uint32_t documentFrequency(uint32_t column) const { return documentFrequency_[column]; }
+
+    size_t vocabularySize() const { return idf_.size(); }
+    size_t documentCount() const { return documentCount_; }
+
+private:
+    static constexpr uint32_t kEmpty = UINT32_MAX;
+
+    struct Slot {
+        uint64_t term;
+        uint32_t column;
+    };
+
+    size_t maxNGram_;
+    size_t minDocumentFrequency_;
+    size_t maxFeatures_;
+    size_t documentCount_;
+    std::vector<Slot> slots_;               // Open addressing, power-of-two size
+    std::vector<float> idf_;
+    std::vector<uint32_t> documentFrequency_;
+
+    uint32_t lookup(uint64_t term) const;
+    void terms(std::string_view text, Scratch& scratch) const;
+};
+
+} // namespace kinepredict
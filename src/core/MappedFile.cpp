@@ -0,0 +1,86 @@
+#include "kinepredict/core/MappedFile.h"
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace kinepredict {
+
+    MappedFile::MappedFile(const std::string& path) : data_(nullptr), size_(0) {
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            throw std::runtime_error("MappedFile: cannot open " + path);
+        }
+
+        struct stat info;
+        if (::fstat(fd, &info) != 0) {
+            ::close(fd);
+            throw std::runtime_error("MappedFile: cannot stat " + path);
+        }
+        size_ = static_cast<size_t>(info.st_size);
+
+        // mmap rejects zero-length mappings; an empty file maps to nothing
+        if (size_ > 0) {
+            void* mapping = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (mapping == MAP_FAILED) {
+                ::close(fd);
+                throw std::runtime_error("MappedFile: cannot map " + path);
+            }
+            data_ = static_cast<const char*>(mapping);
+        }
+
+        // The mapping stays valid after the descriptor is closed
+        ::close(fd);
+    }
+
+    MappedFile::~MappedFile() {
+        unmap();
+    }
+
+    MappedFile::MappedFile(MappedFile&& other) noexcept
+    : data_(std::exchange(other.data_, nullptr)), size_(std::exchange(other.size_, 0)) {
+
+    }
+
+    MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+        if (this != &other) {
+            unmap();
+            data_ = std::exchange(other.data_, nullptr);
+            size_ = std::exchange(other.size_, 0);
+        }
+        return *this;
+    }
+
+    void MappedFile::adviseSequential() const {
+        if (data_) {
+            ::madvise(const_cast<char*>(data_), size_, MADV_SEQUENTIAL);
+        }
+    }
+
+    void MappedFile::release(size_t offset, size_t length) const {
+        if (!data_ || offset >= size_) {
+            return;
+        }
+        length = std::min(length, size_ - offset);
+
+        // Round inward so pages shared with neighbouring ranges stay mapped
+        size_t pageSize = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+        size_t begin = (offset + pageSize - 1) / pageSize * pageSize;
+        size_t end = offset + length == size_ ? size_ : (offset + length) / pageSize * pageSize;
+        if (begin < end) {
+            ::madvise(const_cast<char*>(data_) + begin, end - begin, MADV_DONTNEED);
+        }
+    }
+
+    void MappedFile::unmap() {
+        if (data_) {
+            ::munmap(const_cast<char*>(data_), size_);
+            data_ = nullptr;
+            size_ = 0;
+        }
+    }
+
+}
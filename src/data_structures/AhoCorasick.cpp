@@ -0,0 +1,133 @@
+#include "kinepredict/data_structures/AhoCorasick.h"
+#include "kinepredict/data_structures/Trie.h"
+#include <algorithm>
+#include <exception>
+#include <thread>
+
+namespace kinepredict {
+
+    AhoCorasick::AhoCorasick(const Trie& dictionary) : patternCount_(dictionary.size()) {
+        // Renumber trie nodes breadth-first; children of a state get
+        // consecutive edge slots
+        std::vector<uint32_t> trieIndex = {Trie::kRoot};
+        edgeBegin_.push_back(0);
+        depth_.push_back(0);
+        terminal_.push_back(false);
+
+        for (size_t state = 0; state < trieIndex.size(); ++state) {
+            const Trie::TrieNode& node = dictionary.node(trieIndex[state]);
+            const uint32_t* children = Trie::childIndices(node);
+            for (size_t i = 0; i < node.childCount; ++i) {
+                labels_.push_back(node.children[i]);
+                targets_.push_back(static_cast<uint32_t>(trieIndex.size()));
+                trieIndex.push_back(children[i]);
+                depth_.push_back(depth_[state] + 1);
+                terminal_.push_back(dictionary.node(children[i]).isEndOfWord);
+            }
+            edgeBegin_.push_back(static_cast<uint32_t>(labels_.size()));
+        }
+
+        size_t numStates = trieIndex.size();
+        fail_.assign(numStates, kRoot);
+        output_.assign(numStates, kNone);
+
+        std::fill(std::begin(rootNext_), std::end(rootNext_), kRoot);
+        for (uint32_t e = edgeBegin_[kRoot]; e < edgeBegin_[kRoot + 1]; ++e) {
+            rootNext_[labels_[e]] = targets_[e];
+        }
+
+        // Breadth-first order guarantees a state's failure target is final
+        // before its children are processed
+        for (uint32_t state = 0; state < numStates; ++state) {
+            for (uint32_t e = edgeBegin_[state]; e < edgeBegin_[state + 1]; ++e) {
+                uint32_t target = targets_[e];
+                if (state != kRoot) {
+                    fail_[target] = next(fail_[state], labels_[e]);
+                }
+                uint32_t failure = fail_[target];
+                output_[target] = terminal_[failure] ? failure : output_[failure];
+            }
+        }
+    }
+
+    std::vector<AhoCorasick::Match> AhoCorasick::findAll(std::string_view text) const {
+        std::vector<Match> matches;
+        scan(text, [&matches](const Match& match) { matches.push_back(match); });
+        return matches;
+    }
+
+    std::vector<std::vector<AhoCorasick::Match>> AhoCorasick::findAllBatch(
+        const std::vector<std::string_view>& documents, size_t numThreads) const {
+        std::vector<std::vector<Match>> results(documents.size());
+
+        auto scanRange = [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                scan(documents[i], [&results, i](const Match& match) { results[i].push_back(match); });
+            }
+        };
+
+        numThreads = std::max<size_t>(1, std::min(numThreads, documents.size()));
+        if (numThreads == 1) {
+            scanRange(0, documents.size());
+            return results;
+        }
+
+        // An exception (bad_alloc from a match list) must not escape a
+        // thread, and every thread is joined before this call unwinds
+        size_t perThread = (documents.size() + numThreads - 1) / numThreads;
+        std::vector<std::exception_ptr> errors(numThreads);
+        auto guardedRange = [&](size_t worker) {
+            try {
+                size_t begin = std::min(documents.size(), worker * perThread);
+                scanRange(begin, std::min(documents.size(), begin + perThread));
+            } catch (...) {
+                errors[worker] = std::current_exception();
+            }
+        };
+
+        std::vector<std::thread> workers;
+        auto joinAll = [&workers] {
+            for (auto& worker : workers) {
+                worker.join();
+            }
+        };
+        try {
+            for (size_t worker = 1; worker < numThreads; ++worker) {
+                workers.emplace_back(guardedRange, worker);
+            }
+        } catch (...) {
+            joinAll();
+            throw;
+        }
+        guardedRange(0);  // The calling thread takes the first range
+        joinAll();
+        for (const auto& error : errors) {
+            if (error) {
+                std::rethrow_exception(error);
+            }
+        }
+        return results;
+    }
+
+    bool AhoCorasick::containsAny(std::string_view text) const {
+        uint32_t state = kRoot;
+        for (char c : text) {
+            state = next(state, static_cast<unsigned char>(c));
+            if (terminal_[state] || output_[state] != kNone) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    uint32_t AhoCorasick::child(uint32_t state, unsigned char c) const {
+        auto first = labels_.begin() + edgeBegin_[state];
+        auto last = labels_.begin() + edgeBegin_[state + 1];
+        auto it = std::lower_bound(first, last, c);
+        if (it == last || *it != c) {
+            return kNone;
+        }
+        return targets_[it - labels_.begin()];
+    }
+
+}
@@ -1,43 +1,166 @@
 #include "kinepredict/data_structures/BloomFilter.h"
+#include "kinepredict/data_structures/BloomFilterView.h"
+#include "kinepredict/core/Hash.h"
 #include <cmath>
+#include <cstring>
 #include <algorithm>
+#include <istream>
+#include <ostream>
+#include <stdexcept>
+
+#if defined(__AVX512F__) || defined(__AVX2__)
+#include <immintrin.h>
+#endif
 
 namespace kinepredict {
 
-    BloomFilter::BloomFilter(size_t expectedElements, double falsePositiveRate)
-    : elementCount_(0) {
+    BloomFilter::BloomFilter(size_t expectedElements, double falsePositiveRate, Layout layout)
+    : layout_(layout), elementCount_(0) {
 
         // Calculate optimal bit array size
-        bitArraySize_ = calculateBitArraySize(expectedElements, falsePositiveRate);
+        bitArraySize_ = std::max(size_t(1),
+                                 calculateBitArraySize(expectedElements, falsePositiveRate));
 
         // Calculate optimal number of hash functions
         numHashFunctions_ = calculateNumHashFunctions(bitArraySize_, expectedElements);
 
+        // Blocked layout addresses whole blocks, so round up to a block multiple
+        numBlocks_ = (bitArraySize_ + kBitsPerBlock - 1) / kBitsPerBlock;
+        if (layout_ == Layout::Blocked) {
+            bitArraySize_ = numBlocks_ * kBitsPerBlock;
+        }
+
         // Initialize bit array
-        bitArray_.resize(bitArraySize_, false);
+        blocks_.resize(numBlocks_, Block{});
+    }
+
+    BloomFilter::BloomFilter(const BloomFilterView& view)
+    : blocks_(view.numBlocks_),
+      layout_(view.layout_),
+      numHashFunctions_(view.numHashFunctions_),
+      bitArraySize_(view.bitArraySize_),
+      numBlocks_(view.numBlocks_),
+      elementCount_(view.elementCount_) {
+
+        std::memcpy(words(), view.words_, numBlocks_ * sizeof(Block));
     }
 
     void BloomFilter::add(const std::string& element) {
-        uint64_t h1 = hash1(element);
-        uint64_t h2 = hash2(element);
+        auto [h1, h2] = hash128(element);
+        testAndSet(h1, h2);
+    }
 
-        // Set k bits using double hashing
-        for (size_t i = 0; i < numHashFunctions_; ++i) {
-            size_t index = nthHash(i, h1, h2) % bitArraySize_;
-            bitArray_[index] = true;
+    bool BloomFilter::contains(const std::string& element) const {
+        auto [h1, h2] = hash128(element);
+        return test(h1, h2);
+    }
+
+    // Both probe hashes are re-mixed from the ID: the layouts take block
+    // indices and step sizes from different halves of h1 and h2, which a
+    // raw low-entropy ID (a counter, a bucket index) would leave all-zero.
+    void BloomFilter::addHashed(uint64_t id) {
+        uint64_t h1 = hashMix(id);
+        testAndSet(h1, hashMix(h1));
+    }
+
+    bool BloomFilter::containsHashed(uint64_t id) const {
+        uint64_t h1 = hashMix(id);
+        return test(h1, hashMix(h1));
+    }
+
+    std::vector<uint64_t> BloomFilter::addBatch(const std::vector<std::string_view>& elements) {
+        std::vector<uint64_t> present((elements.size() + 63) / 64, 0);
+        uint64_t h1s[kBatchChunk];
+        uint64_t h2s[kBatchChunk];
+
+        for (size_t base = 0; base < elements.size(); base += kBatchChunk) {
+            size_t count = std::min(kBatchChunk, elements.size() - base);
+
+            // Hash the whole chunk and prefetch, then probe
+            for (size_t i = 0; i < count; ++i) {
+                Hash128 hash = hash128(elements[base + i]);
+                h1s[i] = hash.low;
+                h2s[i] = hash.high;
+                prefetch(h1s[i], h2s[i]);
+            }
+            for (size_t i = 0; i < count; ++i) {
+                size_t index = base + i;
+                if (testAndSet(h1s[i], h2s[i])) {
+                    present[index >> 6] |= uint64_t(1) << (index & 63);
+                }
+            }
+        }
+
+        return present;
+    }
+
+    std::vector<uint64_t> BloomFilter::containsBatch(const std::vector<std::string_view>& elements) const {
+        std::vector<uint64_t> present((elements.size() + 63) / 64, 0);
+        uint64_t h1s[kBatchChunk];
+        uint64_t h2s[kBatchChunk];
+
+        for (size_t base = 0; base < elements.size(); base += kBatchChunk) {
+            size_t count = std::min(kBatchChunk, elements.size() - base);
+
+            for (size_t i = 0; i < count; ++i) {
+                Hash128 hash = hash128(elements[base + i]);
+                h1s[i] = hash.low;
+                h2s[i] = hash.high;
+                prefetch(h1s[i], h2s[i]);
+            }
+            for (size_t i = 0; i < count; ++i) {
+                size_t index = base + i;
+                present[index >> 6] |= uint64_t(test(h1s[i], h2s[i])) << (index & 63);
+            }
+        }
+
+        return present;
+    }
+
+    // Set the key's bits; returns whether they were all set already
+    bool BloomFilter::testAndSet(uint64_t h1, uint64_t h2) {
+        bool present = true;
+
+        if (layout_ == Layout::Blocked) {
+            uint64_t mask[kWordsPerBlock];
+            blockMask(numHashFunctions_, h1, h2, mask);
+            Block& block = blocks_[h1 % numBlocks_];
+            present = blockContains(block.words, mask);
+            for (size_t w = 0; w < kWordsPerBlock; ++w) {
+                block.words[w] |= mask[w];
+            }
+        } else {
+            // Set k bits using double hashing
+            uint64_t* bits = words();
+            for (size_t i = 0; i < numHashFunctions_; ++i) {
+                size_t index = nthHash(i, h1, h2) % bitArraySize_;
+                uint64_t bit = uint64_t(1) << (index & 63);
+                present &= (bits[index >> 6] & bit) != 0;
+                bits[index >> 6] |= bit;
+            }
         }
 
         elementCount_++;
+        return present;
     }
 
-    bool BloomFilter::contains(const std::string& element) const {
-        uint64_t h1 = hash1(element);
-        uint64_t h2 = hash2(element);
+    bool BloomFilter::test(uint64_t h1, uint64_t h2) const {
+        return testBits(words(), layout_, numHashFunctions_, bitArraySize_, numBlocks_, h1, h2);
+    }
+
+    // Probe shared with BloomFilterView, which has no Block storage of its own
+    bool BloomFilter::testBits(const uint64_t* bits, Layout layout, size_t numHashFunctions,
+                               size_t bitArraySize, size_t numBlocks, uint64_t h1, uint64_t h2) {
+        if (layout == Layout::Blocked) {
+            uint64_t mask[kWordsPerBlock];
+            blockMask(numHashFunctions, h1, h2, mask);
+            return blockContains(bits + (h1 % numBlocks) * kWordsPerBlock, mask);
+        }
 
         // Check if all k bits are set
-        for (size_t i = 0; i < numHashFunctions_; ++i) {
-            size_t index = nthHash(i, h1, h2) % bitArraySize_;
-            if (!bitArray_[index]) {
+        for (size_t i = 0; i < numHashFunctions; ++i) {
+            size_t index = nthHash(i, h1, h2) % bitArraySize;
+            if (!(bits[index >> 6] & (uint64_t(1) << (index & 63)))) {
                 return false;  // Definitely not in set
             }
         }
@@ -45,14 +168,155 @@ namespace kinepredict {
         return true;  // Possibly in set
     }
 
+    // Pull the words a key will probe into cache ahead of the probe
+    void BloomFilter::prefetch(uint64_t h1, uint64_t h2) const {
+        if (layout_ == Layout::Blocked) {
+            __builtin_prefetch(&blocks_[h1 % numBlocks_]);
+            return;
+        }
+
+        const uint64_t* bits = words();
+        for (size_t i = 0; i < numHashFunctions_; ++i) {
+            size_t index = nthHash(i, h1, h2) % bitArraySize_;
+            __builtin_prefetch(&bits[index >> 6]);
+        }
+    }
+
+    bool BloomFilter::isCompatible(const BloomFilterView& other) const {
+        return layout_ == other.layout_ &&
+               numHashFunctions_ == other.numHashFunctions_ &&
+               bitArraySize_ == other.bitArraySize_ &&
+               numBlocks_ == other.numBlocks_;
+    }
+
+    void BloomFilter::merge(const BloomFilterView& other) {
+        if (!isCompatible(other)) {
+            throw std::invalid_argument("BloomFilter::merge() requires filters with identical parameters");
+        }
+
+        uint64_t* bits = words();
+        const uint64_t* otherBits = other.words_;
+        size_t numWords = numBlocks_ * kWordsPerBlock;
+        for (size_t i = 0; i < numWords; ++i) {
+            bits[i] |= otherBits[i];
+        }
+
+        elementCount_ = estimateElementCount();
+    }
+
+    void BloomFilter::merge(const BloomFilter& other) {
+        merge(other.view());
+    }
+
+    void BloomFilter::intersect(const BloomFilterView& other) {
+        if (!isCompatible(other)) {
+            throw std::invalid_argument("BloomFilter::intersect() requires filters with identical parameters");
+        }
+
+        uint64_t* bits = words();
+        const uint64_t* otherBits = other.words_;
+        size_t numWords = numBlocks_ * kWordsPerBlock;
+        for (size_t i = 0; i < numWords; ++i) {
+            bits[i] &= otherBits[i];
+        }
+
+        elementCount_ = estimateElementCount();
+    }
+
+    void BloomFilter::intersect(const BloomFilter& other) {
+        intersect(other.view());
+    }
+
+    void BloomFilter::serialize(std::ostream& out) const {
+        BloomFilterView::Header header{};
+        std::memcpy(header.magic, BloomFilterView::kMagic, sizeof(header.magic));
+        header.version = BloomFilterView::kVersion;
+        header.layout = static_cast<uint32_t>(layout_);
+        header.numHashFunctions = static_cast<uint32_t>(numHashFunctions_);
+        header.bitArraySize = bitArraySize_;
+        header.numBlocks = numBlocks_;
+        header.elementCount = elementCount_;
+
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        out.write(reinterpret_cast<const char*>(words()),
+                  static_cast<std::streamsize>(numBlocks_ * sizeof(Block)));
+    }
+
+    BloomFilter BloomFilter::deserialize(std::istream& in) {
+        // Read the header first to learn how many words follow
+        alignas(Block) char headerBytes[sizeof(BloomFilterView::Header)] = {};
+        if (!in.read(headerBytes, sizeof(headerBytes))) {
+            throw std::runtime_error("BloomFilter::deserialize(): shard is truncated");
+        }
+        BloomFilterView::Header header;
+        std::memcpy(&header, headerBytes, sizeof(header));
+        BloomFilterView::validate(header);
+
+        // Grow the buffer as data arrives, so a header claiming a huge
+        // filter on a short stream fails on the read, not the allocation
+        constexpr size_t kChunkBlocks = size_t(1) << 14;   // 1 MiB
+        std::vector<Block> shard(1);
+        std::memcpy(shard.data(), headerBytes, sizeof(headerBytes));
+        for (size_t loaded = 0; loaded < header.numBlocks;) {
+            size_t count = std::min<size_t>(kChunkBlocks, header.numBlocks - loaded);
+            shard.resize(1 + loaded + count);
+            if (!in.read(reinterpret_cast<char*>(shard.data() + 1 + loaded),
+                         static_cast<std::streamsize>(count * sizeof(Block)))) {
+                throw std::runtime_error("BloomFilter::deserialize(): shard is truncated");
+            }
+            loaded += count;
+        }
+
+        return BloomFilter(BloomFilterView(shard.data(), shard.size() * sizeof(Block)));
+    }
+
+    BloomFilterView BloomFilter::view() const {
+        return BloomFilterView(words(), layout_, numHashFunctions_, bitArraySize_,
+                               numBlocks_, elementCount_);
+    }
+
+    // Swamidass & Baldi: n ~= -(m / k) * ln(1 - X / m) for X set bits
+    size_t BloomFilter::estimateElementCount() const {
+        const uint64_t* bits = words();
+        size_t numWords = numBlocks_ * kWordsPerBlock;
+        size_t setBits = 0;
+        for (size_t i = 0; i < numWords; ++i) {
+            setBits += static_cast<size_t>(__builtin_popcountll(bits[i]));
+        }
+
+        double m = static_cast<double>(bitArraySize_);
+        if (setBits >= bitArraySize_) {
+            return static_cast<size_t>(m);
+        }
+        double estimate = -(m / numHashFunctions_) * std::log1p(-static_cast<double>(setBits) / m);
+        return static_cast<size_t>(std::llround(estimate));
+    }
+
     void BloomFilter::clear() {
-        std::fill(bitArray_.begin(), bitArray_.end(), false);
+        std::fill(blocks_.begin(), blocks_.end(), Block{});
         elementCount_ = 0;
     }
 
     double BloomFilter::getFalsePositiveRate() const {
         if (elementCount_ == 0) return 0.0;
 
+        double k = static_cast<double>(numHashFunctions_);
+
+        if (layout_ == Layout::Blocked) {
+            // Block loads follow Poisson(n / blocks); each block behaves like
+            // a small standard filter of kBitsPerBlock bits:
+            // sum_i P(load = i) * (1 - e^(-k*i/B))^k
+            double lambda = static_cast<double>(elementCount_) / numBlocks_;
+            size_t maxLoad = static_cast<size_t>(lambda + 10.0 * std::sqrt(lambda) + 20.0);
+            double rate = 0.0;
+            for (size_t i = 1; i <= maxLoad; ++i) {
+                double logP = i * std::log(lambda) - lambda - std::lgamma(i + 1.0);
+                double base = 1.0 - std::exp(-k * i / kBitsPerBlock);
+                rate += std::exp(logP) * std::pow(base, k);
+            }
+            return rate;
+        }
+
         // Formula: (1 - e^(-kn/m))^k
         // k = numHashFunctions, n = elementCount, m = bitArraySize
         double exponent = -static_cast<double>(numHashFunctions_ * elementCount_) / bitArraySize_;
@@ -62,30 +326,45 @@ namespace kinepredict {
 
     size_t BloomFilter::getMemoryUsage() const {
         // Bit array size in bytes + overhead
-        return (bitArraySize_ / 8) + sizeof(*this);
+        return blocks_.size() * sizeof(Block) + sizeof(*this);
     }
 
-    // Hash function 1: FNV-1a hash
-    uint64_t BloomFilter::hash1(const std::string& element) const {
-        uint64_t hash = 14695981039346656037ULL;  // FNV offset basis
-        for (char c : element) {
-            hash ^= static_cast<uint64_t>(c);
-            hash *= 1099511628211ULL;  // FNV prime
+    // Derive the k in-block bit positions from the hash pair. The block index
+    // is taken from h1, so positions use h2 and the high half of h1 to stay
+    // independent of it.
+    void BloomFilter::blockMask(size_t numHashFunctions, uint64_t h1, uint64_t h2, uint64_t* mask) {
+        std::fill(mask, mask + kWordsPerBlock, 0);
+        uint64_t step = (h1 >> 32) | 1;
+        for (size_t i = 0; i < numHashFunctions; ++i) {
+            size_t bit = nthHash(i, h2, step) & (kBitsPerBlock - 1);
+            mask[bit >> 6] |= uint64_t(1) << (bit & 63);
         }
-        return hash;
     }
 
-    // Hash function 2: DJB2 hash
-    uint64_t BloomFilter::hash2(const std::string& element) const {
-        uint64_t hash = 5381;
-        for (char c : element) {
-            hash = ((hash << 5) + hash) + static_cast<uint64_t>(c);
+    // True if every mask bit is set in the block. Unaligned loads, since a
+    // mapped shard only guarantees 8-byte alignment.
+    bool BloomFilter::blockContains(const uint64_t* block, const uint64_t* mask) {
+#if defined(__AVX512F__)
+        __m512i bits = _mm512_loadu_si512(block);
+        __m512i probe = _mm512_loadu_si512(mask);
+        return _mm512_cmpneq_epi64_mask(_mm512_and_si512(bits, probe), probe) == 0;
+#elif defined(__AVX2__)
+        const __m256i* bits = reinterpret_cast<const __m256i*>(block);
+        const __m256i* probe = reinterpret_cast<const __m256i*>(mask);
+        return _mm256_testc_si256(_mm256_loadu_si256(bits), _mm256_loadu_si256(probe)) &
+               _mm256_testc_si256(_mm256_loadu_si256(bits + 1), _mm256_loadu_si256(probe + 1));
+#else
+        // Branch-free so the compiler can vectorize it
+        uint64_t missing = 0;
+        for (size_t w = 0; w < kWordsPerBlock; ++w) {
+            missing |= mask[w] & ~block[w];
         }
-        return hash;
+        return missing == 0;
+#endif
     }
 
     // Generate nth hash using double hashing
-    uint64_t BloomFilter::nthHash(size_t n, uint64_t hash1, uint64_t hash2) const {
+    uint64_t BloomFilter::nthHash(size_t n, uint64_t hash1, uint64_t hash2) {
         return hash1 + n * hash2;
     }
 
@@ -104,7 +383,7 @@ namespace kinepredict {
         size_t k = static_cast<size_t>(
             (static_cast<double>(m) / n) * std::log(2)
         );
-        return std::max(size_t(1), k);
+        return std::clamp(k, size_t(1), kMaxHashFunctions);
     }
 
 }
\ No newline at end of file
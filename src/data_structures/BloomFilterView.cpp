@@ -0,0 +1,67 @@
+#include "kinepredict/data_structures/BloomFilterView.h"
+#include "kinepredict/core/Hash.h"
+#include "kinepredict/core/MappedFile.h"
+#include <cstring>
+#include <stdexcept>
+
+namespace kinepredict {
+
+    BloomFilterView::BloomFilterView(const void* data, size_t size) {
+        if (reinterpret_cast<uintptr_t>(data) % alignof(uint64_t) != 0) {
+            throw std::runtime_error("BloomFilterView: shard data must be 8-byte aligned");
+        }
+        if (size < sizeof(Header)) {
+            throw std::runtime_error("BloomFilterView: shard is truncated");
+        }
+
+        Header header;
+        std::memcpy(&header, data, sizeof(Header));
+        validate(header);
+        if ((size - sizeof(Header)) / (kWordsPerBlock * sizeof(uint64_t)) < header.numBlocks) {
+            throw std::runtime_error("BloomFilterView: shard is truncated");
+        }
+
+        words_ = reinterpret_cast<const uint64_t*>(static_cast<const char*>(data) + sizeof(Header));
+        layout_ = static_cast<BloomFilter::Layout>(header.layout);
+        numHashFunctions_ = header.numHashFunctions;
+        bitArraySize_ = header.bitArraySize;
+        numBlocks_ = header.numBlocks;
+        elementCount_ = header.elementCount;
+    }
+
+    void BloomFilterView::validate(const Header& header) {
+        if (std::memcmp(header.magic, kMagic, sizeof(kMagic)) != 0 || header.version != kVersion) {
+            throw std::runtime_error("BloomFilterView: not a KinePredict Bloom Filter shard");
+        }
+        constexpr size_t kBitsPerBlock = kWordsPerBlock * 64;
+        constexpr size_t kBytesPerBlock = kWordsPerBlock * sizeof(uint64_t);
+        uint64_t expectedBlocks = header.bitArraySize / kBitsPerBlock + (header.bitArraySize % kBitsPerBlock != 0);
+        if (header.layout > static_cast<uint32_t>(BloomFilter::Layout::Blocked) ||
+            header.numHashFunctions == 0 || header.numHashFunctions > BloomFilter::kMaxHashFunctions ||
+            header.bitArraySize == 0 || header.numBlocks != expectedBlocks ||
+            header.numBlocks > (SIZE_MAX - sizeof(Header)) / kBytesPerBlock) {
+            throw std::runtime_error("BloomFilterView: corrupt shard header");
+        }
+    }
+
+    BloomFilterView::BloomFilterView(const uint64_t* words, BloomFilter::Layout layout,
+                                     size_t numHashFunctions, size_t bitArraySize,
+                                     size_t numBlocks, size_t elementCount)
+    : words_(words), layout_(layout), numHashFunctions_(numHashFunctions),
+      bitArraySize_(bitArraySize), numBlocks_(numBlocks), elementCount_(elementCount) {
+
+    }
+
+    BloomFilterView BloomFilterView::open(const std::string& path) {
+        auto file = std::make_shared<const MappedFile>(path);
+        BloomFilterView view(file->data(), file->size());
+        view.file_ = std::move(file);
+        return view;
+    }
+
+    bool BloomFilterView::contains(std::string_view element) const {
+        auto [h1, h2] = hash128(element);
+        return BloomFilter::testBits(words_, layout_, numHashFunctions_, bitArraySize_, numBlocks_, h1, h2);
+    }
+
+}
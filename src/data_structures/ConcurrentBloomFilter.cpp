@@ -0,0 +1,89 @@
+#include "kinepredict/data_structures/ConcurrentBloomFilter.h"
+#include "kinepredict/data_structures/BloomFilter.h"
+#include "kinepredict/core/Hash.h"
+#include <cmath>
+#include <algorithm>
+
+namespace kinepredict {
+
+    ConcurrentBloomFilter::ConcurrentBloomFilter(size_t expectedElements, double falsePositiveRate) {
+        // Same sizing as BloomFilter
+        bitArraySize_ = std::max(size_t(1),
+                                 BloomFilter::calculateBitArraySize(expectedElements, falsePositiveRate));
+        numHashFunctions_ = BloomFilter::calculateNumHashFunctions(bitArraySize_, expectedElements);
+
+        numWords_ = (bitArraySize_ + 63) / 64;
+        words_ = std::make_unique<std::atomic<uint64_t>[]>(numWords_);
+        clear();
+    }
+
+    bool ConcurrentBloomFilter::add(std::string_view element) {
+        auto [h1, h2] = hash128(element);
+
+        // Relaxed is enough: bits only ever go from 0 to 1
+        bool present = true;
+        for (size_t i = 0; i < numHashFunctions_; ++i) {
+            size_t index = BloomFilter::nthHash(i, h1, h2) % bitArraySize_;
+            uint64_t bit = uint64_t(1) << (index & 63);
+            uint64_t previous = words_[index >> 6].fetch_or(bit, std::memory_order_relaxed);
+            present &= (previous & bit) != 0;
+        }
+
+        counters_[counterShard()].count.fetch_add(1, std::memory_order_relaxed);
+        return present;
+    }
+
+    bool ConcurrentBloomFilter::contains(std::string_view element) const {
+        auto [h1, h2] = hash128(element);
+
+        for (size_t i = 0; i < numHashFunctions_; ++i) {
+            size_t index = BloomFilter::nthHash(i, h1, h2) % bitArraySize_;
+            uint64_t bit = uint64_t(1) << (index & 63);
+            if (!(words_[index >> 6].load(std::memory_order_relaxed) & bit)) {
+                return false;  // Definitely not in set
+            }
+        }
+
+        return true;  // Possibly in set
+    }
+
+    void ConcurrentBloomFilter::clear() {
+        for (size_t i = 0; i < numWords_; ++i) {
+            words_[i].store(0, std::memory_order_relaxed);
+        }
+        for (auto& shard : counters_) {
+            shard.count.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    size_t ConcurrentBloomFilter::getElementCount() const {
+        size_t total = 0;
+        for (const auto& shard : counters_) {
+            total += shard.count.load(std::memory_order_relaxed);
+        }
+        return total;
+    }
+
+    double ConcurrentBloomFilter::getFalsePositiveRate() const {
+        size_t elementCount = getElementCount();
+        if (elementCount == 0) return 0.0;
+
+        // Formula: (1 - e^(-kn/m))^k
+        double exponent = -static_cast<double>(numHashFunctions_ * elementCount) / bitArraySize_;
+        double base = 1.0 - std::exp(exponent);
+        return std::pow(base, numHashFunctions_);
+    }
+
+    size_t ConcurrentBloomFilter::getMemoryUsage() const {
+        return numWords_ * sizeof(std::atomic<uint64_t>) + sizeof(*this);
+    }
+
+    // Threads are assigned shards round-robin on first use
+    size_t ConcurrentBloomFilter::counterShard() {
+        static std::atomic<size_t> nextShard{0};
+        thread_local size_t shard =
+            nextShard.fetch_add(1, std::memory_order_relaxed) % kCounterShards;
+        return shard;
+    }
+
+}
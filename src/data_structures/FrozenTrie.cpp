@@ -0,0 +1,210 @@
+#include "kinepredict/data_structures/FrozenTrie.h"
+#include "kinepredict/data_structures/Trie.h"
+#include <algorithm>
+#include <utility>
+
+namespace kinepredict {
+
+    FrozenTrie::FrozenTrie() : wordCount_(0) {
+        ensureSlots(1);
+        check_[kRoot] = kRoot;
+    }
+
+    FrozenTrie::FrozenTrie(const Trie& trie) : FrozenTrie() {
+        wordCount_ = trie.wordCount_;
+
+        // Free slots form a doubly-linked list so the base search skips
+        // occupied regions
+        std::vector<uint32_t> nextFree;
+        std::vector<uint32_t> prevFree;
+        std::vector<bool> linked;
+        uint32_t freeHead = kNone;
+        uint32_t freeTail = kNone;
+
+        auto grow = [&](size_t count) {
+            size_t oldSize = check_.size();
+            ensureSlots(count);
+            nextFree.resize(check_.size(), kNone);
+            prevFree.resize(check_.size(), kNone);
+            linked.resize(check_.size(), true);
+            for (size_t slot = oldSize; slot < check_.size(); ++slot) {
+                prevFree[slot] = freeTail;
+                if (freeTail == kNone) {
+                    freeHead = static_cast<uint32_t>(slot);
+                } else {
+                    nextFree[freeTail] = static_cast<uint32_t>(slot);
+                }
+                freeTail = static_cast<uint32_t>(slot);
+            }
+        };
+
+        auto unlink = [&](uint32_t slot) {
+            if (!linked[slot]) return;  // Already abandoned
+            linked[slot] = false;
+            if (prevFree[slot] == kNone) freeHead = nextFree[slot];
+            else nextFree[prevFree[slot]] = nextFree[slot];
+            if (nextFree[slot] == kNone) freeTail = prevFree[slot];
+            else prevFree[nextFree[slot]] = prevFree[slot];
+        };
+
+        // Breadth-first: place each node's children at the first base where
+        // all of their slots are free
+        std::vector<std::pair<uint32_t, uint32_t>> queue = {{Trie::kRoot, kRoot}};
+        std::vector<std::pair<uint16_t, uint32_t>> children;
+        size_t usedSlots = 1;
+
+        for (size_t q = 0; q < queue.size(); ++q) {
+            auto [source, id] = queue[q];
+            const Trie::TrieNode& node = trie.node(source);
+            if (node.isEndOfWord) {
+                terminal_[id >> 6] |= uint64_t(1) << (id & 63);
+            }
+            if (node.childCount == 0) continue;
+
+            // Trie children are already sorted by byte value
+            children.clear();
+            const uint32_t* indices = Trie::childIndices(node);
+            for (size_t i = 0; i < node.childCount; ++i) {
+                children.emplace_back(static_cast<uint16_t>(node.children[i] + 1), indices[i]);
+            }
+            uint16_t lowest = children.front().first;
+            uint16_t highest = children.back().first;
+
+            // The first child lands on a free slot, so only free slots are
+            // candidates
+            uint32_t base = 0;
+            uint32_t pos = freeHead;
+            uint32_t last = kNone;
+            size_t tried = 0;
+            while (true) {
+                if (pos == kNone) {
+                    grow(check_.size() + highest + 1);
+                    pos = last == kNone ? freeHead : nextFree[last];
+                    continue;
+                }
+                if (pos >= lowest) {
+                    base = pos - lowest;
+                    grow(static_cast<size_t>(base) + highest + 1);
+                    bool fits = std::all_of(children.begin(), children.end(),
+                                            [&](const auto& c) { return check_[base + c.first] == kNone; });
+                    if (fits) break;
+                }
+                ++tried;
+                last = pos;
+                pos = nextFree[pos];
+            }
+
+            base_[id] = base;
+            firstChild_[id] = lowest;
+            for (size_t i = 0; i < children.size(); ++i) {
+                uint32_t slot = base + children[i].first;
+                check_[slot] = id;
+                unlink(slot);
+                nextSibling_[slot] = i + 1 < children.size() ? children[i + 1].first : 0;
+                queue.emplace_back(children[i].second, slot);
+                usedSlots = std::max<size_t>(usedSlots, slot + 1);
+            }
+
+            // Stop offering free slots that keep failing; they stay unused.
+            // This bounds the scan and keeps the build near-linear.
+            for (; tried > kMaxBaseTries && freeHead != kNone; --tried) {
+                unlink(freeHead);
+            }
+        }
+
+        // Drop the unused tail the base search reserved
+        base_.resize(usedSlots);
+        check_.resize(usedSlots);
+        firstChild_.resize(usedSlots);
+        nextSibling_.resize(usedSlots);
+        terminal_.resize((usedSlots + 63) / 64);
+        base_.shrink_to_fit();
+        check_.shrink_to_fit();
+        firstChild_.shrink_to_fit();
+        nextSibling_.shrink_to_fit();
+        terminal_.shrink_to_fit();
+    }
+
+    bool FrozenTrie::search(std::string_view word) const {
+        if (word.empty()) return false;
+
+        uint32_t node = walk(word);
+        return node != kNone && isTerminal(node);
+    }
+
+    bool FrozenTrie::startsWith(std::string_view prefix) const {
+        return walk(prefix) != kNone;
+    }
+
+    std::vector<std::string> FrozenTrie::getWordsWithPrefix(std::string_view prefix) const {
+        std::vector<std::string> results;
+
+        uint32_t start = walk(prefix);
+        if (start == kNone) {
+            return results;  // Prefix not found, return empty
+        }
+
+        // Pre-order walk over first-child/next-sibling links, editing one
+        // buffer in place instead of building a string per level
+        std::string word(prefix);
+        uint32_t node = start;
+        while (true) {
+            if (isTerminal(node)) {
+                results.push_back(word);
+            }
+
+            if (firstChild_[node] != 0) {
+                word.push_back(static_cast<char>(firstChild_[node] - 1));
+                node = base_[node] + firstChild_[node];
+                continue;
+            }
+
+            while (node != start && nextSibling_[node] == 0) {
+                node = check_[node];
+                word.pop_back();
+            }
+            if (node == start) break;
+
+            uint16_t sibling = nextSibling_[node];
+            node = base_[check_[node]] + sibling;
+            word.back() = static_cast<char>(sibling - 1);
+        }
+
+        return results;
+    }
+
+    size_t FrozenTrie::getMemoryUsage() const {
+        return sizeof(*this) +
+               base_.capacity() * sizeof(uint32_t) +
+               check_.capacity() * sizeof(uint32_t) +
+               firstChild_.capacity() * sizeof(uint16_t) +
+               nextSibling_.capacity() * sizeof(uint16_t) +
+               terminal_.capacity() * sizeof(uint64_t);
+    }
+
+    // Follow key from the root; returns the node reached or kNone
+    uint32_t FrozenTrie::walk(std::string_view key) const {
+        uint32_t node = kRoot;
+        for (char c : key) {
+            size_t next = static_cast<size_t>(base_[node]) + code(c);
+            if (next >= check_.size() || check_[next] != node) {
+                return kNone;
+            }
+            node = static_cast<uint32_t>(next);
+        }
+        return node;
+    }
+
+    void FrozenTrie::ensureSlots(size_t count) {
+        if (count <= check_.size()) return;
+
+        // Grow geometrically so the base search doesn't reallocate per node
+        size_t newSize = std::max(count, check_.size() * 2);
+        base_.resize(newSize, 0);
+        check_.resize(newSize, kNone);
+        firstChild_.resize(newSize, 0);
+        nextSibling_.resize(newSize, 0);
+        terminal_.resize((newSize + 63) / 64, 0);
+    }
+
+}
@@ -0,0 +1,147 @@
+#include "kinepredict/data_structures/LshIndex.h"
+#include "kinepredict/core/Hash.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <string_view>
+
+namespace kinepredict {
+
+    namespace {
+
+        // Candidates are re-checked against the full signature, so a false
+        // positive costs one comparison while a false negative is a missed
+        // duplicate: weight the latter more
+        constexpr double kFalsePositiveWeight = 0.2;
+        constexpr double kFalseNegativeWeight = 0.8;
+
+        // Weighted area under the candidate curve below the threshold
+        // (false positives) plus the area above the curve beyond it (false
+        // negatives), by midpoint integration
+        double bandingError(size_t bands, size_t rows, double threshold) {
+            constexpr int kSteps = 200;
+            auto probability = [&](double s) {
+                return 1.0 - std::pow(1.0 - std::pow(s, static_cast<double>(rows)), static_cast<double>(bands));
+            };
+            double falsePositives = 0.0;
+            double falseNegatives = 0.0;
+            for (int i = 0; i < kSteps; ++i) {
+                double below = threshold * (i + 0.5) / kSteps;
+                double above = threshold + (1.0 - threshold) * (i + 0.5) / kSteps;
+                falsePositives += probability(below) * threshold / kSteps;
+                falseNegatives += (1.0 - probability(above)) * (1.0 - threshold) / kSteps;
+            }
+            return kFalsePositiveWeight * falsePositives + kFalseNegativeWeight * falseNegatives;
+        }
+
+    }
+
+    LshIndex::LshIndex(size_t numHashes, double threshold)
+    : numHashes_(numHashes), numBands_(1), rowsPerBand_(numHashes), threshold_(threshold), count_(0) {
+        if (numHashes == 0) {
+            throw std::invalid_argument("numHashes must be positive");
+        }
+        if (!(threshold > 0.0 && threshold <= 1.0)) {
+            throw std::invalid_argument("threshold must be in (0, 1]");
+        }
+
+        double bestError = bandingError(numBands_, rowsPerBand_, threshold);
+        for (size_t bands = 2; bands <= numHashes; ++bands) {
+            size_t rows = numHashes / bands;
+            double error = bandingError(bands, rows, threshold);
+            if (error < bestError) {
+                bestError = error;
+                numBands_ = bands;
+                rowsPerBand_ = rows;
+            }
+        }
+        heads_.resize(numBands_);
+    }
+
+    LshIndex::Id LshIndex::insert(const std::vector<uint32_t>& signature) {
+        checkLength(signature);
+        if (count_ == kNone) {
+            throw std::length_error("LshIndex is full");
+        }
+        Id id = static_cast<Id>(count_);
+        signatures_.insert(signatures_.end(), signature.begin(), signature.end());
+        next_.resize(next_.size() + numBands_, kNone);
+        if (isEmpty(signature)) {
+            ++count_;
+            return id;   // Stored, but in no bucket
+        }
+
+        for (size_t band = 0; band < numBands_; ++band) {
+            auto [slot, inserted] = heads_[band].try_emplace(bandKey(signature.data(), band), id);
+            next_[static_cast<size_t>(id) * numBands_ + band] = inserted ? kNone : slot->second;
+            slot->second = id;
+        }
+        ++count_;
+        return id;
+    }
+
+    void LshIndex::candidates(const std::vector<uint32_t>& signature, std::vector<Id>& candidates) const {
+        checkLength(signature);
+        candidates.clear();
+        if (isEmpty(signature)) {
+            return;
+        }
+        for (size_t band = 0; band < numBands_; ++band) {
+            auto slot = heads_[band].find(bandKey(signature.data(), band));
+            if (slot == heads_[band].end()) {
+                continue;
+            }
+            for (Id id = slot->second; id != kNone; id = next_[static_cast<size_t>(id) * numBands_ + band]) {
+                candidates.push_back(id);
+            }
+        }
+        std::sort(candidates.begin(), candidates.end());
+        candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
+    }
+
+    std::vector<LshIndex::Match> LshIndex::query(const std::vector<uint32_t>& signature) const {
+        std::vector<Id> ids;
+        candidates(signature, ids);
+
+        // Agreement needed to reach the threshold, in whole slots
+        size_t required = static_cast<size_t>(std::ceil(threshold_ * numHashes_ - 1e-9));
+        std::vector<Match> matches;
+        for (Id id : ids) {
+            const uint32_t* stored = signatureOf(id);
+            size_t equal = 0;
+            for (size_t i = 0; i < numHashes_; ++i) {
+                equal += stored[i] == signature[i];
+            }
+            if (equal >= required) {
+                matches.push_back({id, static_cast<double>(equal) / numHashes_});
+            }
+        }
+        std::sort(matches.begin(), matches.end(), [](const Match& a, const Match& b) {
+            return a.similarity != b.similarity ? a.similarity > b.similarity : a.id < b.id;
+        });
+        return matches;
+    }
+
+    double LshIndex::candidateProbability(double similarity) const {
+        return 1.0 - std::pow(1.0 - std::pow(similarity, static_cast<double>(rowsPerBand_)),
+                              static_cast<double>(numBands_));
+    }
+
+    bool LshIndex::isEmpty(const std::vector<uint32_t>& signature) {
+        return std::all_of(signature.begin(), signature.end(),
+                           [](uint32_t slot) { return slot == UINT32_MAX; });
+    }
+
+    uint64_t LshIndex::bandKey(const uint32_t* signature, size_t band) const {
+        std::string_view rows(reinterpret_cast<const char*>(signature + band * rowsPerBand_),
+                              rowsPerBand_ * sizeof(uint32_t));
+        return hash64(rows, band);
+    }
+
+    void LshIndex::checkLength(const std::vector<uint32_t>& signature) const {
+        if (signature.size() != numHashes_) {
+            throw std::invalid_argument("signature length must equal numHashes");
+        }
+    }
+
+}
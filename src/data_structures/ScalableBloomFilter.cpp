@@ -0,0 +1,81 @@
+#include "kinepredict/data_structures/ScalableBloomFilter.h"
+#include <algorithm>
+#include <stdexcept>
+
+namespace kinepredict {
+
+    ScalableBloomFilter::ScalableBloomFilter(size_t initialCapacity, double falsePositiveRate,
+                                             BloomFilter::Layout layout,
+                                             double growthFactor, double tighteningRatio)
+    : initialCapacity_(std::max(size_t(1), initialCapacity)),
+      layout_(layout),
+      growthFactor_(growthFactor),
+      tighteningRatio_(tighteningRatio) {
+
+        if (growthFactor < 1.0) {
+            throw std::invalid_argument("ScalableBloomFilter growth factor must be >= 1");
+        }
+        if (tighteningRatio <= 0.0 || tighteningRatio >= 1.0) {
+            throw std::invalid_argument("ScalableBloomFilter tightening ratio must be in (0, 1)");
+        }
+
+        // P0 + P0*r + P0*r^2 + ... = P0 / (1 - r) <= falsePositiveRate
+        initialRate_ = falsePositiveRate * (1.0 - tighteningRatio);
+        clear();
+    }
+
+    void ScalableBloomFilter::add(const std::string& element) {
+        if (filters_.back().getElementCount() >= capacities_.back()) {
+            addFilter(static_cast<size_t>(capacities_.back() * growthFactor_));
+        }
+        filters_.back().add(element);
+    }
+
+    bool ScalableBloomFilter::contains(const std::string& element) const {
+        // Newest first: it holds the most elements
+        for (auto it = filters_.rbegin(); it != filters_.rend(); ++it) {
+            if (it->contains(element)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void ScalableBloomFilter::clear() {
+        filters_.clear();
+        capacities_.clear();
+        nextRate_ = initialRate_;
+        addFilter(initialCapacity_);
+    }
+
+    double ScalableBloomFilter::getFalsePositiveRate() const {
+        double allNegative = 1.0;
+        for (const auto& filter : filters_) {
+            allNegative *= 1.0 - filter.getFalsePositiveRate();
+        }
+        return 1.0 - allNegative;
+    }
+
+    size_t ScalableBloomFilter::getMemoryUsage() const {
+        size_t total = sizeof(*this) + capacities_.capacity() * sizeof(size_t);
+        for (const auto& filter : filters_) {
+            total += filter.getMemoryUsage();
+        }
+        return total;
+    }
+
+    size_t ScalableBloomFilter::getElementCount() const {
+        size_t total = 0;
+        for (const auto& filter : filters_) {
+            total += filter.getElementCount();
+        }
+        return total;
+    }
+
+    void ScalableBloomFilter::addFilter(size_t capacity) {
+        filters_.emplace_back(capacity, nextRate_, layout_);
+        capacities_.push_back(capacity);
+        nextRate_ *= tighteningRatio_;
+    }
+
+}
@@ -0,0 +1,181 @@
+#include "kinepredict/data_structures/SlidingWindowBloomFilter.h"
+#include "kinepredict/data_structures/BloomFilter.h"
+#include "kinepredict/core/Hash.h"
+#include <cmath>
+#include <algorithm>
+#include <stdexcept>
+
+namespace kinepredict {
+
+    SlidingWindowBloomFilter::SlidingWindowBloomFilter(Clock::duration window, double expectedPerSecond,
+                                                       double falsePositiveRate, size_t generations,
+                                                       Clock::time_point start)
+    : window_(window), removedCount_(0) {
+
+        if (generations == 0 || window.count() <= 0) {
+            throw std::invalid_argument("SlidingWindowBloomFilter needs a positive window and generation count");
+        }
+        generationLength_ = std::max(Clock::duration(1), window / static_cast<Clock::rep>(generations));
+
+        // Live generations start within the last window plus one generation
+        numSlots_ = static_cast<size_t>((window_ + 2 * generationLength_ - Clock::duration(1)) / generationLength_);
+
+        // Each generation holds one generation's inserts; the live bitmaps
+        // share the target rate so their union stays within it
+        double generationSeconds = std::chrono::duration<double>(generationLength_).count();
+        size_t perGeneration = std::max(size_t(1),
+                                        static_cast<size_t>(std::ceil(expectedPerSecond * generationSeconds)));
+        bitsPerGeneration_ = std::max(size_t(64),
+                                      BloomFilter::calculateBitArraySize(perGeneration, falsePositiveRate / numSlots_));
+        numHashFunctions_ = BloomFilter::calculateNumHashFunctions(bitsPerGeneration_, perGeneration);
+        wordsPerGeneration_ = (bitsPerGeneration_ + 63) / 64;
+        bits_.resize(numSlots_ * wordsPerGeneration_, 0);
+
+        generations_.push_back({start, 0, 0, {}});
+    }
+
+    void SlidingWindowBloomFilter::add(std::string_view element, Clock::time_point now) {
+        advance(now);
+
+        auto [h1, h2] = hash128(element);
+        uint64_t* bits = bits_.data() + generations_.back().slot * wordsPerGeneration_;
+        for (size_t i = 0; i < numHashFunctions_; ++i) {
+            size_t index = BloomFilter::nthHash(i, h1, h2) % bitsPerGeneration_;
+            bits[index >> 6] |= uint64_t(1) << (index & 63);
+        }
+        generations_.back().count++;
+
+        // Re-adding cancels a removal
+        if (removedCount_ > 0) {
+            for (auto& generation : generations_) {
+                auto& removed = generation.removed;
+                auto it = std::find(removed.begin(), removed.end(), std::make_pair(h1, h2));
+                if (it != removed.end()) {
+                    *it = removed.back();
+                    removed.pop_back();
+                    removedCount_--;
+                }
+            }
+        }
+    }
+
+    bool SlidingWindowBloomFilter::contains(std::string_view element) const {
+        auto [h1, h2] = hash128(element);
+
+        for (auto generation = generations_.rbegin(); generation != generations_.rend(); ++generation) {
+            if (testBits(generation->slot, h1, h2)) {
+                return !isRemoved(h1, h2);  // Possibly in window
+            }
+        }
+
+        return false;  // Definitely not in window
+    }
+
+    bool SlidingWindowBloomFilter::remove(std::string_view element) {
+        auto [h1, h2] = hash128(element);
+        if (isRemoved(h1, h2)) {
+            return false;
+        }
+
+        // Record it with the newest generation that has it, so the record
+        // lasts as long as any of its bits
+        for (auto generation = generations_.rbegin(); generation != generations_.rend(); ++generation) {
+            if (testBits(generation->slot, h1, h2)) {
+                generation->removed.emplace_back(h1, h2);
+                if (generation->count > 0) {
+                    generation->count--;
+                }
+                removedCount_++;
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    void SlidingWindowBloomFilter::advance(Clock::time_point now) {
+        // After a long idle period everything has expired
+        if (now - generations_.back().start >= window_ + generationLength_) {
+            clear(now);
+            return;
+        }
+
+        // A generation expires once its newest possible element is a full
+        // window old; expire before starting new ones so bitmaps are free
+        while (generations_.size() > 1 &&
+               generations_.front().start + generationLength_ + window_ <= now) {
+            removedCount_ -= generations_.front().removed.size();
+            generations_.pop_front();
+        }
+
+        while (now - generations_.back().start >= generationLength_) {
+            startGeneration(generations_.back().start + generationLength_);
+        }
+    }
+
+    void SlidingWindowBloomFilter::clear(Clock::time_point now) {
+        std::fill(bits_.begin(), bits_.end(), 0);
+        generations_.clear();
+        generations_.push_back({now, 0, 0, {}});
+        removedCount_ = 0;
+    }
+
+    size_t SlidingWindowBloomFilter::getElementCount() const {
+        size_t total = 0;
+        for (const auto& generation : generations_) {
+            total += generation.count;
+        }
+        return total;
+    }
+
+    double SlidingWindowBloomFilter::getFalsePositiveRate() const {
+        // A miss must miss every live generation: 1 - prod(1 - (1 - e^(-kn/m))^k)
+        double allMiss = 1.0;
+        for (const auto& generation : generations_) {
+            double exponent = -static_cast<double>(numHashFunctions_ * generation.count) / bitsPerGeneration_;
+            allMiss *= 1.0 - std::pow(1.0 - std::exp(exponent), numHashFunctions_);
+        }
+        return 1.0 - allMiss;
+    }
+
+    size_t SlidingWindowBloomFilter::getMemoryUsage() const {
+        size_t total = bits_.size() * sizeof(uint64_t) + sizeof(*this);
+        for (const auto& generation : generations_) {
+            total += sizeof(Generation) +
+                     generation.removed.capacity() * sizeof(std::pair<uint64_t, uint64_t>);
+        }
+        return total;
+    }
+
+    bool SlidingWindowBloomFilter::testBits(size_t slot, uint64_t h1, uint64_t h2) const {
+        const uint64_t* bits = bits_.data() + slot * wordsPerGeneration_;
+        for (size_t i = 0; i < numHashFunctions_; ++i) {
+            size_t index = BloomFilter::nthHash(i, h1, h2) % bitsPerGeneration_;
+            if ((bits[index >> 6] & (uint64_t(1) << (index & 63))) == 0) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool SlidingWindowBloomFilter::isRemoved(uint64_t h1, uint64_t h2) const {
+        if (removedCount_ == 0) {
+            return false;
+        }
+        for (const auto& generation : generations_) {
+            if (std::find(generation.removed.begin(), generation.removed.end(),
+                          std::make_pair(h1, h2)) != generation.removed.end()) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void SlidingWindowBloomFilter::startGeneration(Clock::time_point start) {
+        // The slot after the newest is free: at most numSlots_ are ever live
+        size_t slot = (generations_.back().slot + 1) % numSlots_;
+        std::fill_n(bits_.begin() + slot * wordsPerGeneration_, wordsPerGeneration_, 0);
+        generations_.push_back({start, slot, 0, {}});
+    }
+
+}
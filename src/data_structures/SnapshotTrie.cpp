@@ -0,0 +1,69 @@
+#include "kinepredict/data_structures/SnapshotTrie.h"
+#include <thread>
+#include <utility>
+
+namespace kinepredict {
+
+    SnapshotTrie::SnapshotTrie() : SnapshotTrie(Trie()) {
+
+    }
+
+    SnapshotTrie::SnapshotTrie(Trie initial) : current_(new Trie(std::move(initial))), epoch_(0) {
+
+    }
+
+    SnapshotTrie::~SnapshotTrie() {
+        delete current_.load();
+    }
+
+    void SnapshotTrie::publish(Trie next) {
+        Trie* replacement = new Trie(std::move(next));
+        std::lock_guard<std::mutex> lock(publishMutex_);
+
+        // Readers announced after the epoch bump load the new pointer; only
+        // those under the old parity can still hold the old one
+        Trie* previous = current_.exchange(replacement);
+        uint64_t epoch = epoch_.fetch_add(1);
+
+        for (auto& shard : readers_[epoch & 1]) {
+            while (shard.active.load() != 0) {
+                std::this_thread::yield();
+            }
+        }
+
+        delete previous;
+    }
+
+    bool SnapshotTrie::search(const std::string& word) const {
+        return read([&](const Trie& trie) { return trie.search(word); });
+    }
+
+    bool SnapshotTrie::startsWith(const std::string& prefix) const {
+        return read([&](const Trie& trie) { return trie.startsWith(prefix); });
+    }
+
+    std::vector<std::string> SnapshotTrie::getWordsWithPrefix(const std::string& prefix) const {
+        return read([&](const Trie& trie) { return trie.getWordsWithPrefix(prefix); });
+    }
+
+    std::vector<Trie::Completion> SnapshotTrie::topK(const std::string& prefix, size_t k) const {
+        return read([&](const Trie& trie) { return trie.topK(prefix, k); });
+    }
+
+    size_t SnapshotTrie::size() const {
+        return read([](const Trie& trie) { return trie.size(); });
+    }
+
+    uint64_t SnapshotTrie::getVersion() const {
+        return epoch_.load(std::memory_order_relaxed);
+    }
+
+    // Threads are assigned shards round-robin on first use
+    size_t SnapshotTrie::readerShard() {
+        static std::atomic<size_t> nextShard{0};
+        thread_local size_t shard =
+            nextShard.fetch_add(1, std::memory_order_relaxed) % kReaderShards;
+        return shard;
+    }
+
+}
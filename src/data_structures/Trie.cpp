@@ -1,111 +1,442 @@
 #include "kinepredict/data_structures/Trie.h"
+#include "kinepredict/data_structures/FrozenTrie.h"
+#include <algorithm>
+#include <cstring>
+#include <new>
+#include <utility>
 
 namespace kinepredict {
 
-    Trie::Trie() : root_(std::make_unique<TrieNode>()), wordCount_(0) {
+    Trie::Trie() : Trie(std::pmr::new_delete_resource()) {
 
     }
 
-    Trie::~Trie() = default;
+    Trie::Trie(std::pmr::memory_resource* resource)
+    : resource_(resource), chunkCursor_(nullptr), chunkRemaining_(0), nodeCount_(0), wordCount_(0),
+      longestWord_(0) {
+        newNode('\0');  // Root
+    }
 
-    void Trie::insert(const std::string& word) {
-        // Your algorithm here
-        // Hint: loop through characters, navigate/create nodes
+    Trie::~Trie() {
+        releaseMemory();
+    }
 
-        if (word.empty()) return;
+    Trie::Trie(Trie&& other) noexcept
+    : resource_(other.resource_),
+      slabs_(std::move(other.slabs_)),
+      chunks_(std::move(other.chunks_)),
+      chunkCursor_(std::exchange(other.chunkCursor_, nullptr)),
+      chunkRemaining_(std::exchange(other.chunkRemaining_, 0)),
+      nodeCount_(std::exchange(other.nodeCount_, 0)),
+      wordCount_(std::exchange(other.wordCount_, 0)),
+      longestWord_(std::exchange(other.longestWord_, 0)) {
 
-        TrieNode* current = root_.get();
+        for (size_t i = 0; i < kBlockClasses; ++i) {
+            freeBlocks_[i] = std::move(other.freeBlocks_[i]);
+            other.freeBlocks_[i].clear();
+        }
+        other.slabs_.clear();
+        other.chunks_.clear();
+    }
 
-        for (char c : word) {
-            if (current->children.find(c) == current->children.end()) {
-                current->children[c] = std::make_unique<TrieNode>();
+    Trie& Trie::operator=(Trie&& other) noexcept {
+        if (this != &other) {
+            releaseMemory();
+            resource_ = other.resource_;
+            slabs_ = std::move(other.slabs_);
+            chunks_ = std::move(other.chunks_);
+            for (size_t i = 0; i < kBlockClasses; ++i) {
+                freeBlocks_[i] = std::move(other.freeBlocks_[i]);
+                other.freeBlocks_[i].clear();
             }
-            current = current->children[c].get();
+            other.slabs_.clear();
+            other.chunks_.clear();
+            chunkCursor_ = std::exchange(other.chunkCursor_, nullptr);
+            chunkRemaining_ = std::exchange(other.chunkRemaining_, 0);
+            nodeCount_ = std::exchange(other.nodeCount_, 0);
+            wordCount_ = std::exchange(other.wordCount_, 0);
+            longestWord_ = std::exchange(other.longestWord_, 0);
         }
+        return *this;
+    }
 
-        if (!current->isEndOfWord) {
-            current->isEndOfWord = true;
-            ++wordCount_;
-        }
+    void Trie::insert(const std::string& word) {
+        insertWord(word, 0.0f, false);
+    }
+
+    void Trie::insert(const std::string& word, float weight) {
+        insertWord(word, weight, true);
     }
 
     bool Trie::search(const std::string& word) const {
-        // Your algorithm here
-        // Hint: similar to insert, but just check, don't create
         if (word.empty()) return false;
 
-        const TrieNode* current = root_.get();
-
-        for (char c : word) {
-            auto it = current->children.find(c);
-            if (it == current->children.end()) {
-                return false;  // Character not found
-            }
-            current = it->second.get();
-        }
-
-        return current->isEndOfWord;
+        uint32_t current = findNode(word);
+        return current != kNoNode && node(current).isEndOfWord;
     }
 
 
     bool Trie::startsWith(const std::string& prefix) const {
         if (prefix.empty()) return true;
 
-        const TrieNode* current = root_.get();
-
-        for (char c : prefix) {
-            auto it = current->children.find(c);
-            if (it == current->children.end()) {
-                return false;
-            }
-            current = it->second.get();
-        }
-
-        return true;  // All characters in prefix found
+        return findNode(prefix) != kNoNode;  // All characters in prefix found
     }
 
     std::vector<std::string> Trie::getWordsWithPrefix(const std::string& prefix) const {
         std::vector<std::string> results;
 
         // Navigate to the prefix node
-        const TrieNode* current = root_.get();
-        for (char ch : prefix) {
-            auto it = current->children.find(ch);
-            if (it == current->children.end()) {
-                return results;  // Prefix not found, return empty
+        uint32_t current = findNode(prefix);
+        if (current == kNoNode) {
+            return results;  // Prefix not found, return empty
+        }
+
+        if (node(current).isEndOfWord) {
+            results.push_back(prefix);
+        }
+
+        // Pre-order walk with an explicit stack, editing one buffer in place
+        std::string word = prefix;
+        std::vector<std::pair<uint32_t, uint16_t>> stack = {{current, 0}};   // Node, next child
+        while (!stack.empty()) {
+            auto [index, next] = stack.back();
+            const TrieNode& parent = node(index);
+            if (next == parent.childCount) {
+                stack.pop_back();
+                if (!stack.empty()) word.pop_back();
+                continue;
+            }
+
+            stack.back().second++;
+            uint32_t child = childIndices(parent)[next];
+            word.push_back(node(child).label);
+            if (node(child).isEndOfWord) {
+                results.push_back(word);
             }
-            current = it->second.get();
+            stack.emplace_back(child, 0);
         }
 
-        // Collect all words starting from this node
-        collectWords(current, prefix, results);
+        return results;
+    }
 
+    std::vector<Trie::Completion> Trie::topK(const std::string& prefix, size_t k) const {
+        std::vector<Completion> results;
+        Completions cursor = completions(prefix);
+        while (results.size() < k) {
+            std::optional<Completion> completion = cursor.next();
+            if (!completion) break;
+            results.push_back(std::move(*completion));
+        }
         return results;
     }
 
-    void Trie::collectWords(const TrieNode* node, const std::string& prefix,
-                        std::vector<std::string>& results) const {
-        if (!node) return;
+    Trie::Completions Trie::completions(const std::string& prefix) const {
+        return Completions(*this, prefix, findNode(prefix));
+    }
 
-        if (node->isEndOfWord) {
-            results.push_back(prefix);
+    Trie::Completions::Completions(const Trie& trie, const std::string& prefix, uint32_t start)
+    : trie_(&trie), prefix_(prefix), steps_{{kNoNode, '\0'}} {
+        if (start != kNoNode) {
+            frontier_.push({trie.node(start).bestWeight, start, 0, false});
         }
+    }
 
-        // Recursively explore all children
-        for (const auto& [ch, childNode] : node->children) {
-            collectWords(childNode.get(), prefix + ch, results);
+    std::optional<Trie::Completion> Trie::Completions::next() {
+        while (!frontier_.empty()) {
+            Entry entry = frontier_.pop();
+
+            if (entry.isWord) {
+                // Spell the word by following steps back to the prefix node
+                std::string suffix;
+                for (uint32_t step = entry.step; step != 0; step = steps_[step].parent) {
+                    suffix.push_back(steps_[step].label);
+                }
+                return Completion{prefix_ + std::string(suffix.rbegin(), suffix.rend()), entry.score};
+            }
+
+            // Expand a subtree: its own word and each child compete on their bounds
+            const TrieNode& current = trie_->node(entry.node);
+            if (current.isEndOfWord) {
+                frontier_.push({current.weight, entry.node, entry.step, true});
+            }
+            const uint32_t* children = childIndices(current);
+            for (size_t i = 0; i < current.childCount; ++i) {
+                const TrieNode& child = trie_->node(children[i]);
+                steps_.push_back({entry.step, child.label});
+                frontier_.push({child.bestWeight, children[i], static_cast<uint32_t>(steps_.size() - 1), false});
+            }
         }
+        return std::nullopt;
+    }
+
+    std::vector<Trie::FuzzyMatch> Trie::fuzzySearch(const std::string& word, size_t maxEdits) const {
+        std::vector<FuzzyMatch> results;
+
+        // No word is further than max(|word|, longest key) edits away, so a
+        // larger bound finds nothing more; clamping keeps limit and the
+        // band arithmetic below from overflowing
+        maxEdits = std::min(maxEdits, std::max(word.size(), longestWord_));
+
+        const size_t columns = word.size() + 1;
+        const size_t limit = maxEdits + 1;   // Every cell is capped here: "too far"
+
+        // rows[d * columns + j]: distance between the first d path labels
+        // and word[0, j); one row per depth, reused across branches
+        std::vector<size_t> rows(columns);
+        for (size_t j = 0; j < columns; ++j) {
+            rows[j] = std::min(j, limit);
+        }
+
+        std::string path;
+        std::vector<std::pair<uint32_t, size_t>> stack;   // Node, depth
+        const TrieNode& root = node(kRoot);
+        for (size_t i = root.childCount; i-- > 0;) {
+            stack.emplace_back(childIndices(root)[i], 1);
+        }
+
+        while (!stack.empty()) {
+            auto [index, depth] = stack.back();
+            stack.pop_back();
+            const TrieNode& current = node(index);
+            path.resize(depth - 1);
+            path.push_back(current.label);
+
+            if (rows.size() < (depth + 1) * columns) {
+                rows.resize((depth + 1) * columns);
+            }
+            const size_t* previous = &rows[(depth - 1) * columns];
+            size_t* row = &rows[depth * columns];
+
+            // Cells more than maxEdits off the diagonal can't be within bound
+            size_t first = depth > maxEdits ? depth - maxEdits : 1;
+            size_t last = std::min(columns - 1, depth + maxEdits);
+            row[0] = std::min(depth, limit);
+            std::fill(row + 1, row + columns, limit);
+
+            size_t best = row[0];
+            for (size_t j = first; j <= last; ++j) {
+                size_t substitute = previous[j - 1] + (word[j - 1] != current.label);
+                size_t cell = std::min({previous[j] + 1, row[j - 1] + 1, substitute, limit});
+                row[j] = cell;
+                best = std::min(best, cell);
+            }
+
+            if (current.isEndOfWord && row[columns - 1] <= maxEdits) {
+                results.push_back({path, row[columns - 1]});
+            }
+
+            // Prune: extending the path can only keep or raise the row minimum
+            if (best <= maxEdits) {
+                const uint32_t* children = childIndices(current);
+                for (size_t i = current.childCount; i-- > 0;) {
+                    stack.emplace_back(children[i], depth + 1);
+                }
+            }
+        }
+
+        std::sort(results.begin(), results.end(), [](const FuzzyMatch& a, const FuzzyMatch& b) {
+            return a.distance != b.distance ? a.distance < b.distance : a.word < b.word;
+        });
+        return results;
     }
 
     void Trie::clear() {
-        root_ = std::make_unique<TrieNode>();
+        releaseMemory();
         wordCount_ = 0;
+        longestWord_ = 0;
+        newNode('\0');  // Root
     }
 
     size_t Trie::size() const {
         return wordCount_;
     }
 
+    size_t Trie::getMemoryUsage() const {
+        return sizeof(*this) + slabs_.capacity() * sizeof(TrieNode*) +
+               slabs_.size() * kSlabSize * sizeof(TrieNode) +
+               chunks_.capacity() * sizeof(unsigned char*) +
+               chunks_.size() * kChunkBytes;
+    }
+
+    FrozenTrie Trie::freeze() const {
+        return FrozenTrie(*this);
+    }
+
+    uint32_t Trie::newNode(char label) {
+        if ((nodeCount_ & (kSlabSize - 1)) == 0) {
+            void* slab = resource_->allocate(kSlabSize * sizeof(TrieNode), alignof(TrieNode));
+            slabs_.push_back(static_cast<TrieNode*>(slab));
+        }
 
+        uint32_t index = nodeCount_++;
+        new (&node(index)) TrieNode{nullptr, 0, 0, label, false, 0.0f, kNoWeight};
+        return index;
+    }
+
+    uint32_t Trie::findChild(uint32_t parent, char label) const {
+        const TrieNode& current = node(parent);
+        const unsigned char* labels = current.children;
+        unsigned char target = static_cast<unsigned char>(label);
+
+        // Labels are sorted and packed in one line for small fan-out
+        size_t low = 0;
+        size_t high = current.childCount;
+        while (high - low > 16) {
+            size_t middle = (low + high) / 2;
+            if (labels[middle] < target) low = middle + 1;
+            else high = middle;
+        }
+        // labels[high] may be the match itself, so scan up to the end
+        for (; low < current.childCount; ++low) {
+            if (labels[low] >= target) {
+                return labels[low] == target ? childIndices(current)[low] : kNoNode;
+            }
+        }
+        return kNoNode;  // Character not found
+    }
+
+    uint32_t Trie::addChild(uint32_t parent, char label) {
+        uint32_t created = newNode(label);
+        TrieNode& current = node(parent);
+
+        // Move to the next size class when the block is full
+        if (current.children == nullptr || current.childCount == blockCapacity(current.capacityClass)) {
+            uint8_t capacityClass = current.children == nullptr ? 0 : current.capacityClass + 1;
+            unsigned char* block = allocateBlock(capacityClass);
+            TrieNode grown{block, current.childCount, capacityClass, current.label,
+                           current.isEndOfWord, current.weight, current.bestWeight};
+            if (current.children != nullptr) {
+                std::memcpy(block, current.children, current.childCount);
+                std::memcpy(childIndices(grown), childIndices(current), current.childCount * sizeof(uint32_t));
+                freeBlocks_[current.capacityClass].push_back(current.children);
+            }
+            current = grown;
+        }
+
+        // Insert in sorted position
+        unsigned char* labels = current.children;
+        uint32_t* indices = childIndices(current);
+        size_t position = current.childCount;
+        while (position > 0 && labels[position - 1] > static_cast<unsigned char>(label)) {
+            labels[position] = labels[position - 1];
+            indices[position] = indices[position - 1];
+            --position;
+        }
+        labels[position] = static_cast<unsigned char>(label);
+        indices[position] = created;
+        current.childCount++;
+
+        return created;
+    }
+
+    uint32_t Trie::findNode(const std::string& key) const {
+        uint32_t current = kRoot;
+        for (char c : key) {
+            current = findChild(current, c);
+            if (current == kNoNode) {
+                return kNoNode;
+            }
+        }
+        return current;
+    }
+
+    void Trie::insertWord(const std::string& word, float weight, bool setWeight) {
+        if (word.empty()) return;
+
+        path_.clear();
+        path_.push_back(kRoot);
+        uint32_t current = kRoot;
+
+        for (char c : word) {
+            uint32_t child = findChild(current, c);
+            current = child != kNoNode ? child : addChild(current, c);
+            path_.push_back(current);
+        }
+
+        TrieNode& end = node(current);
+        float oldWeight = end.isEndOfWord ? end.weight : kNoWeight;
+        if (!end.isEndOfWord) {
+            end.isEndOfWord = true;
+            ++wordCount_;
+            longestWord_ = std::max(longestWord_, word.size());
+        } else if (!setWeight) {
+            return;  // Plain insert keeps the existing weight
+        }
+        end.weight = weight;
+
+        updateBestWeights(oldWeight, weight);
+    }
+
+    // Propagate a changed word weight up path_. Raising a bound is O(1) per
+    // level; only a lowered maximum rescans that node's children. Stops as
+    // soon as a node's bound is unchanged.
+    void Trie::updateBestWeights(float oldWeight, float newWeight) {
+        for (size_t i = path_.size(); i-- > 0;) {
+            TrieNode& current = node(path_[i]);
+            float before = current.bestWeight;
+
+            float after = before;
+            if (newWeight >= before) {
+                after = newWeight;
+            } else if (oldWeight >= before) {
+                // The old maximum went down; recompute from scratch
+                after = current.isEndOfWord ? current.weight : kNoWeight;
+                const uint32_t* children = childIndices(current);
+                for (size_t j = 0; j < current.childCount; ++j) {
+                    after = std::max(after, node(children[j]).bestWeight);
+                }
+            }
+
+            if (after == before) break;
+            current.bestWeight = after;
+            oldWeight = before;
+            newWeight = after;
+        }
+    }
+
+    size_t Trie::blockBytes(uint8_t capacityClass) {
+        size_t capacity = blockCapacity(capacityClass);
+        return ((capacity + 3) & ~size_t(3)) + capacity * sizeof(uint32_t);
+    }
+
+    // Child blocks are bump-allocated from chunks; outgrown ones are reused
+    unsigned char* Trie::allocateBlock(uint8_t capacityClass) {
+        auto& reusable = freeBlocks_[capacityClass];
+        if (!reusable.empty()) {
+            unsigned char* block = reusable.back();
+            reusable.pop_back();
+            return block;
+        }
+
+        size_t bytes = blockBytes(capacityClass);
+        if (chunkRemaining_ < bytes) {
+            chunkCursor_ = static_cast<unsigned char*>(resource_->allocate(kChunkBytes, alignof(uint32_t)));
+            chunkRemaining_ = kChunkBytes;
+            chunks_.push_back(chunkCursor_);
+        }
+
+        unsigned char* block = chunkCursor_;
+        chunkCursor_ += bytes;
+        chunkRemaining_ -= bytes;
+        return block;
+    }
+
+    // TrieNode is trivially destructible, so slabs and chunks are returned as raw memory
+    void Trie::releaseMemory() {
+        for (TrieNode* slab : slabs_) {
+            resource_->deallocate(slab, kSlabSize * sizeof(TrieNode), alignof(TrieNode));
+        }
+        for (unsigned char* chunk : chunks_) {
+            resource_->deallocate(chunk, kChunkBytes, alignof(uint32_t));
+        }
+        slabs_.clear();
+        chunks_.clear();
+        for (auto& reusable : freeBlocks_) {
+            reusable.clear();
+        }
+        chunkCursor_ = nullptr;
+        chunkRemaining_ = 0;
+        nodeCount_ = 0;
+    }
 
-}
\ No newline at end of file
+}
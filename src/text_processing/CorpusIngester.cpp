@@ -0,0 +1,243 @@
+#include "kinepredict/text_processing/CorpusIngester.h"
+#include "kinepredict/text_processing/TextProcessor.h"
+#include "kinepredict/core/MappedFile.h"
+#include "kinepredict/core/Hash.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <exception>
+#include <stdexcept>
+#include <thread>
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+namespace kinepredict {
+
+    namespace {
+
+        // Keywords a worker buffers before taking the trie mutex
+        constexpr size_t kKeywordBatch = 4096;
+
+        // Slots in a worker's direct-mapped cache of keywords it has already
+        // queued; vocabularies are heavily skewed, so most tokens hit it
+        constexpr size_t kSeenSlots = 1 << 14;
+
+        // Calls onLine(view) for each line of text. Newlines are located a
+        // register at a time: compare, movemask, then walk the set bits, so
+        // short lines don't pay a call per line.
+        template<typename OnLine>
+        void forEachLine(std::string_view text, OnLine onLine) {
+            const char* data = text.data();
+            size_t size = text.size();
+            size_t lineStart = 0;
+
+            auto emit = [&](size_t lineEnd) {
+                size_t end = lineEnd;
+                if (end > lineStart && data[end - 1] == '\r') {
+                    --end;
+                }
+                onLine(std::string_view(data + lineStart, end - lineStart));
+                lineStart = lineEnd + 1;
+            };
+
+            size_t pos = 0;
+#if defined(__AVX2__)
+            const __m256i newline = _mm256_set1_epi8('\n');
+            for (; pos + 32 <= size; pos += 32) {
+                __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + pos));
+                uint32_t mask = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(block, newline)));
+                for (; mask != 0; mask &= mask - 1) {
+                    emit(pos + static_cast<size_t>(__builtin_ctz(mask)));
+                }
+            }
+#elif defined(__SSE2__)
+            const __m128i newline = _mm_set1_epi8('\n');
+            for (; pos + 16 <= size; pos += 16) {
+                __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + pos));
+                uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(block, newline)));
+                for (; mask != 0; mask &= mask - 1) {
+                    emit(pos + static_cast<size_t>(__builtin_ctz(mask)));
+                }
+            }
+#endif
+            for (; pos < size; ++pos) {
+                if (data[pos] == '\n') {
+                    emit(pos);
+                }
+            }
+            if (lineStart < size) {
+                emit(size);  // Final line without a terminator
+            }
+        }
+
+    }
+
+    CorpusIngester::CorpusIngester(ConcurrentBloomFilter& dedup, Trie& keywords,
+                                   size_t numThreads, size_t chunkBytes)
+    : dedup_(dedup), keywords_(keywords),
+      numThreads_(numThreads != 0 ? numThreads : std::max(1u, std::thread::hardware_concurrency())),
+      chunkBytes_(chunkBytes) {
+        if (chunkBytes == 0) {
+            throw std::invalid_argument("chunkBytes must be positive");
+        }
+    }
+
+    IngestStats CorpusIngester::ingestFile(const std::string& path) {
+        MappedFile file(path);
+        file.adviseSequential();
+        return run(std::string_view(file.data(), file.size()), [&file](size_t begin, size_t end) {
+            file.release(begin, end - begin);
+        });
+    }
+
+    IngestStats CorpusIngester::ingest(std::string_view corpus) {
+        return run(corpus, [](size_t, size_t) {});
+    }
+
+    void CorpusIngester::splitLines(std::string_view text, std::vector<std::string_view>& lines) {
+        lines.clear();
+        forEachLine(text, [&lines](std::string_view line) { lines.push_back(line); });
+    }
+
+    template<typename OnChunkDone>
+    IngestStats CorpusIngester::run(std::string_view corpus, OnChunkDone onChunkDone) {
+        auto startTime = std::chrono::steady_clock::now();
+        size_t numChunks = (corpus.size() + chunkBytes_ - 1) / chunkBytes_;
+
+        // A chunk owns the lines that start inside it: it begins just past
+        // the first newline at or after the previous chunk's last byte
+        auto lineStart = [&](size_t chunk) -> size_t {
+            size_t offset = chunk * chunkBytes_;
+            if (offset == 0) {
+                return 0;
+            }
+            if (offset >= corpus.size()) {
+                return corpus.size();
+            }
+            const char* from = corpus.data() + offset - 1;
+            const void* newline = std::memchr(from, '\n', corpus.size() - offset + 1);
+            return newline ? static_cast<size_t>(static_cast<const char*>(newline) - corpus.data()) + 1
+                           : corpus.size();
+        };
+
+        std::atomic<size_t> nextChunk{0};
+        size_t numWorkers = std::max<size_t>(1, std::min(numThreads_, numChunks));
+        std::vector<IngestStats> workerStats(numWorkers);
+
+        auto work = [&](size_t worker) {
+            IngestStats local;
+            std::string buffer;
+            std::vector<std::string_view> tokens;
+
+            // Strings are kept between batches so their capacity is reused
+            std::vector<std::string> pending;
+            size_t pendingCount = 0;
+            std::vector<std::string> seen(kSeenSlots);
+            auto flush = [&] {
+                if (pendingCount == 0) {
+                    return;
+                }
+                std::lock_guard<std::mutex> lock(keywordsMutex_);
+                for (size_t i = 0; i < pendingCount; ++i) {
+                    keywords_.insert(pending[i]);
+                }
+                pendingCount = 0;
+            };
+
+            auto onLine = [&](std::string_view line) {
+                ++local.lines;
+                TextProcessor::normalize(line, buffer, tokens);
+                if (tokens.empty()) {
+                    ++local.blankLines;
+                    return;
+                }
+                if (dedup_.add(buffer)) {
+                    ++local.duplicateLines;
+                    return;
+                }
+                ++local.uniqueLines;
+                local.keywords += tokens.size();
+                for (std::string_view token : tokens) {
+                    // The trie only grows during a run, so a keyword this
+                    // worker already queued needs no second insert
+                    std::string& slot = seen[hash64(token) & (kSeenSlots - 1)];
+                    if (slot == token) {
+                        continue;
+                    }
+                    slot.assign(token.data(), token.size());
+                    if (pendingCount == pending.size()) {
+                        pending.emplace_back(token);
+                    } else {
+                        pending[pendingCount].assign(token.data(), token.size());
+                    }
+                    ++pendingCount;
+                }
+                if (pendingCount >= kKeywordBatch) {
+                    flush();
+                }
+            };
+
+            for (size_t chunk = nextChunk.fetch_add(1, std::memory_order_relaxed); chunk < numChunks;
+                 chunk = nextChunk.fetch_add(1, std::memory_order_relaxed)) {
+                size_t begin = lineStart(chunk);
+                size_t end = lineStart(chunk + 1);
+                forEachLine(corpus.substr(begin, end - begin), onLine);
+                onChunkDone(begin, end);
+            }
+            flush();
+            workerStats[worker] = local;
+        };
+
+        // An exception (bad_alloc, a failed trie insert) must not escape a
+        // thread, and every thread must be joined before the corpus can be
+        // unmapped; the first failure also stops further chunks being claimed
+        std::vector<std::exception_ptr> errors(numWorkers);
+        auto guardedWork = [&](size_t worker) {
+            try {
+                work(worker);
+            } catch (...) {
+                errors[worker] = std::current_exception();
+                nextChunk.store(numChunks, std::memory_order_relaxed);
+            }
+        };
+
+        std::vector<std::thread> threads;
+        auto joinAll = [&threads] {
+            for (auto& thread : threads) {
+                thread.join();
+            }
+        };
+        try {
+            for (size_t worker = 1; worker < numWorkers; ++worker) {
+                threads.emplace_back(guardedWork, worker);
+            }
+        } catch (...) {
+            nextChunk.store(numChunks, std::memory_order_relaxed);
+            joinAll();
+            throw;
+        }
+        guardedWork(0);  // The calling thread is worker 0
+        joinAll();
+        for (const auto& error : errors) {
+            if (error) {
+                std::rethrow_exception(error);
+            }
+        }
+
+        IngestStats stats;
+        for (const auto& local : workerStats) {
+            stats.lines += local.lines;
+            stats.uniqueLines += local.uniqueLines;
+            stats.duplicateLines += local.duplicateLines;
+            stats.blankLines += local.blankLines;
+            stats.keywords += local.keywords;
+        }
+        stats.bytes = corpus.size();
+        stats.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+        return stats;
+    }
+
+}
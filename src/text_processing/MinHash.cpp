@@ -0,0 +1,116 @@
+#include "kinepredict/text_processing/MinHash.h"
+#include "kinepredict/text_processing/TextProcessor.h"
+#include "kinepredict/core/Hash.h"
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+namespace kinepredict {
+
+    namespace {
+
+        // Per-thread buffers for the text path, reused across calls
+        struct Scratch {
+            std::string buffer;
+            std::vector<std::string_view> tokens;
+            std::vector<uint64_t> shingles;
+        };
+
+        Scratch& scratch() {
+            thread_local Scratch instance;
+            return instance;
+        }
+
+    }
+
+    MinHash::MinHash(size_t numHashes, size_t maxShingle, uint64_t seed) : maxShingle_(maxShingle) {
+        if (numHashes == 0) {
+            throw std::invalid_argument("numHashes must be positive");
+        }
+        if (maxShingle == 0 || maxShingle > TextProcessor::kMaxHashedNGram) {
+            throw std::invalid_argument("maxShingle must be in 1..TextProcessor::kMaxHashedNGram");
+        }
+        seeds_.resize(numHashes);
+        multipliers_.resize(numHashes);
+        for (size_t i = 0; i < numHashes; ++i) {
+            uint64_t bits = hashMix(hashCombine(seed, i));
+            seeds_[i] = static_cast<uint32_t>(bits);
+            multipliers_[i] = static_cast<uint32_t>(bits >> 32) | 1;   // Odd, so a permutation
+        }
+    }
+
+    void MinHash::signature(std::string_view text, std::vector<uint32_t>& signature) const {
+        Scratch& local = scratch();
+        TextProcessor::normalize(text, local.buffer, local.tokens);
+        TextProcessor::hashNGrams(local.tokens, 1, maxShingle_, local.shingles);
+        this->signature(local.shingles, signature);
+    }
+
+    std::vector<uint32_t> MinHash::signature(std::string_view text) const {
+        std::vector<uint32_t> result;
+        signature(text, result);
+        return result;
+    }
+
+    void MinHash::signature(const std::vector<uint64_t>& shingles, std::vector<uint32_t>& signature) const {
+        const size_t k = seeds_.size();
+        signature.assign(k, std::numeric_limits<uint32_t>::max());
+
+        uint32_t* slots = signature.data();
+        const uint32_t* seeds = seeds_.data();
+        const uint32_t* multipliers = multipliers_.data();
+        for (uint64_t shingle : shingles) {
+            uint32_t x = static_cast<uint32_t>(shingle ^ (shingle >> 32));
+            // Straight-line body over contiguous arrays: vectorized as
+            // xor, mullo, shift/xor and unsigned min
+            for (size_t i = 0; i < k; ++i) {
+                uint32_t h = (x ^ seeds[i]) * multipliers[i];
+                h ^= h >> 15;
+                slots[i] = std::min(slots[i], h);
+            }
+        }
+    }
+
+    void MinHash::shingles(std::string_view text, std::vector<uint64_t>& shingles) const {
+        Scratch& local = scratch();
+        TextProcessor::normalize(text, local.buffer, local.tokens);
+        TextProcessor::hashNGrams(local.tokens, 1, maxShingle_, shingles);
+        std::sort(shingles.begin(), shingles.end());
+        shingles.erase(std::unique(shingles.begin(), shingles.end()), shingles.end());
+    }
+
+    double MinHash::similarity(const std::vector<uint32_t>& a, const std::vector<uint32_t>& b) {
+        if (a.size() != b.size()) {
+            throw std::invalid_argument("signatures must have the same length");
+        }
+        if (a.empty()) {
+            return 1.0;
+        }
+        size_t equal = 0;
+        for (size_t i = 0; i < a.size(); ++i) {
+            equal += a[i] == b[i];
+        }
+        return static_cast<double>(equal) / a.size();
+    }
+
+    double MinHash::jaccard(const std::vector<uint64_t>& a, const std::vector<uint64_t>& b) {
+        if (a.empty() && b.empty()) {
+            return 1.0;
+        }
+        size_t common = 0;
+        for (size_t i = 0, j = 0; i < a.size() && j < b.size();) {
+            if (a[i] < b[j]) {
+                ++i;
+            } else if (b[j] < a[i]) {
+                ++j;
+            } else {
+                ++common;
+                ++i;
+                ++j;
+            }
+        }
+        return static_cast<double>(common) / (a.size() + b.size() - common);
+    }
+
+}
@@ -0,0 +1,296 @@
+#include "kinepredict/text_processing/SentimentLexicon.h"
+#include "kinepredict/text_processing/TextProcessor.h"
+#include "kinepredict/core/Hash.h"
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <stdexcept>
+
+namespace kinepredict {
+
+    namespace {
+
+        // Built-in English lexicon, scores from -5 (very negative) to +5
+        // (very positive), aimed at headline and ad copy. Words are already
+        // normalized.
+        constexpr LexiconEntry kBuiltinLexicon[] = {
+            // Negators
+            {"not", 0, true}, {"no", 0, true}, {"never", 0, true}, {"nothing", 0, true},
+            {"nobody", 0, true}, {"none", 0, true}, {"neither", 0, true}, {"nor", 0, true},
+            {"without", 0, true}, {"hardly", 0, true}, {"barely", 0, true},
+            {"don't", 0, true}, {"dont", 0, true}, {"doesn't", 0, true}, {"doesnt", 0, true},
+            {"didn't", 0, true}, {"didnt", 0, true}, {"isn't", 0, true}, {"isnt", 0, true},
+            {"aren't", 0, true}, {"arent", 0, true}, {"wasn't", 0, true}, {"wasnt", 0, true},
+            {"weren't", 0, true}, {"werent", 0, true}, {"won't", 0, true}, {"wont", 0, true},
+            {"can't", 0, true}, {"cant", 0, true}, {"cannot", 0, true}, {"couldn't", 0, true},
+            {"couldnt", 0, true}, {"shouldn't", 0, true}, {"shouldnt", 0, true},
+            {"wouldn't", 0, true}, {"wouldnt", 0, true}, {"ain't", 0, true},
+
+            // Positive
+            {"amazing", 4}, {"awesome", 4}, {"outstanding", 5}, {"superb", 5}, {"breathtaking", 5},
+            {"fantastic", 4}, {"wonderful", 4}, {"incredible", 4}, {"excellent", 3}, {"brilliant", 4},
+            {"stunning", 4}, {"spectacular", 4}, {"phenomenal", 4}, {"magnificent", 4}, {"perfect", 3},
+            {"love", 3}, {"loved", 3}, {"loves", 3}, {"lovely", 3}, {"adore", 3},
+            {"best", 3}, {"great", 3}, {"greatest", 3}, {"exceptional", 4}, {"extraordinary", 4},
+            {"exciting", 3}, {"excited", 3}, {"thrilled", 4}, {"thrilling", 4}, {"delight", 3},
+            {"delightful", 3}, {"delighted", 3}, {"happy", 3}, {"happiest", 3}, {"joy", 3},
+            {"joyful", 3}, {"win", 4}, {"wins", 4}, {"winner", 4}, {"winning", 4},
+            {"success", 2}, {"successful", 3}, {"triumph", 4}, {"victory", 3}, {"celebrate", 3},
+            {"good", 3}, {"better", 2}, {"nice", 3}, {"fun", 4}, {"cool", 1},
+            {"beautiful", 3}, {"gorgeous", 3}, {"elegant", 2}, {"stylish", 2}, {"fresh", 1},
+            {"free", 1}, {"bonus", 2}, {"save", 2}, {"saves", 2}, {"savings", 1},
+            {"deal", 1}, {"bargain", 2}, {"exclusive", 2}, {"premium", 2}, {"quality", 2},
+            {"easy", 1}, {"effortless", 2}, {"simple", 1}, {"fast", 1}, {"instant", 1},
+            {"reliable", 2}, {"trusted", 2}, {"proven", 2}, {"safe", 1}, {"secure", 2},
+            {"guaranteed", 2}, {"comfortable", 2}, {"cozy", 2}, {"powerful", 2}, {"innovative", 2},
+            {"revolutionary", 3}, {"inspiring", 3}, {"inspired", 2}, {"smart", 1}, {"clever", 2},
+            {"helpful", 2}, {"useful", 2}, {"valuable", 2}, {"worth", 2}, {"recommended", 2},
+            {"favorite", 2}, {"favourite", 2}, {"popular", 2}, {"trending", 1}, {"hot", 1},
+            {"boost", 1}, {"improve", 2}, {"improved", 2}, {"upgrade", 1}, {"gain", 2},
+            {"gains", 2}, {"grow", 1}, {"growth", 2}, {"thrive", 2}, {"profit", 2},
+            {"rich", 2}, {"healthy", 2}, {"glowing", 2}, {"radiant", 2}, {"calm", 2},
+            {"relax", 2}, {"relaxing", 2}, {"peaceful", 2}, {"hope", 2}, {"hopeful", 2},
+            {"proud", 2}, {"grateful", 3}, {"thanks", 2}, {"thank", 2}, {"welcome", 2},
+            {"wow", 4}, {"yay", 2}, {"enjoy", 2}, {"enjoyed", 2}, {"satisfied", 2},
+            {"impressive", 3}, {"remarkable", 2}, {"unforgettable", 3}, {"legendary", 3}, {"epic", 3},
+            {"flawless", 4}, {"ultimate", 2}, {"top", 2}, {"ideal", 2}, {"rewarding", 2},
+            {"reward", 2}, {"rewards", 2}, {"gift", 2}, {"gifts", 2}, {"treat", 2},
+            {"affordable", 2}, {"cheap", 1}, {"discount", 1}, {"sale", 1},
+
+            // Negative
+            {"bad", -3}, {"worse", -3}, {"worst", -3}, {"terrible", -3}, {"horrible", -3},
+            {"awful", -3}, {"dreadful", -3}, {"disaster", -2}, {"disastrous", -3}, {"catastrophe", -3},
+            {"hate", -3}, {"hated", -3}, {"hates", -3}, {"hateful", -3}, {"disgusting", -3},
+            {"poor", -2}, {"cheaply", -2}, {"broken", -1}, {"fail", -2}, {"fails", -2},
+            {"failed", -2}, {"failure", -2}, {"lose", -3}, {"loses", -3}, {"losing", -3},
+            {"loss", -3}, {"lost", -3}, {"sad", -2}, {"sadly", -2}, {"unhappy", -2},
+            {"angry", -3}, {"furious", -3}, {"annoying", -2}, {"annoyed", -2}, {"frustrating", -2},
+            {"frustrated", -2}, {"disappointing", -2}, {"disappointed", -2}, {"disappointment", -2},
+            {"regret", -2}, {"boring", -3}, {"bored", -2}, {"dull", -2}, {"mediocre", -3},
+            {"useless", -2}, {"worthless", -2}, {"waste", -1}, {"wasted", -2}, {"overpriced", -3},
+            {"expensive", -1}, {"costly", -2}, {"scam", -2}, {"fraud", -4}, {"fake", -3},
+            {"risk", -2}, {"risky", -2}, {"danger", -2}, {"dangerous", -2}, {"warning", -3},
+            {"threat", -2}, {"crisis", -3}, {"problem", -2}, {"problems", -2}, {"trouble", -2},
+            {"mistake", -2}, {"mistakes", -2}, {"wrong", -2}, {"error", -2}, {"errors", -2},
+            {"bug", -2}, {"buggy", -2}, {"slow", -1}, {"difficult", -1}, {"hard", -1},
+            {"painful", -2}, {"pain", -2}, {"hurt", -2}, {"suffer", -2}, {"suffering", -2},
+            {"scary", -2}, {"afraid", -2}, {"fear", -2}, {"panic", -3}, {"shocking", -2},
+            {"shock", -2}, {"ugly", -3}, {"nasty", -3}, {"toxic", -3}, {"sick", -2},
+            {"dead", -3}, {"death", -2}, {"kill", -3}, {"killed", -3}, {"destroy", -3},
+            {"destroyed", -3}, {"ruin", -2}, {"ruined", -2}, {"crash", -2}, {"collapse", -2},
+            {"decline", -1}, {"drop", -1}, {"plunge", -2}, {"lawsuit", -2}, {"scandal", -3},
+            {"outrage", -3}, {"complaint", -2}, {"complain", -2}, {"recall", -2}, {"ban", -2},
+            {"banned", -2}, {"weak", -2}, {"lame", -2}, {"stupid", -2}, {"ridiculous", -3},
+            {"avoid", -1}, {"unfortunately", -2}, {"tragic", -2}, {"tragedy", -2},
+        };
+
+        // Displacement step, so consecutive displacements give unrelated slots
+        constexpr uint64_t kDisplacementStep = 0x9e3779b97f4a7c15ULL;
+
+        // Seeds tried before giving up; each fails only if a bucket finds no
+        // displacement or two words share a 64-bit hash
+        constexpr int kMaxSeeds = 16;
+
+        size_t bucketOf(uint64_t hash, size_t numBuckets) {
+            return static_cast<size_t>(((hash >> 32) * numBuckets) >> 32);
+        }
+
+        uint32_t positionOf(uint64_t hash, uint32_t displacement, size_t numSlots) {
+            uint64_t mixed = hashMix(hash + displacement * kDisplacementStep);
+            return static_cast<uint32_t>(((mixed & 0xffffffffULL) * numSlots) >> 32);
+        }
+
+        // Finds one displacement per bucket so that every hash lands in its
+        // own slot; returns false if some bucket has none within the limit
+        bool placeAll(const std::vector<uint64_t>& hashes, size_t numBuckets,
+                      std::vector<uint32_t>& displacements, std::vector<uint32_t>& slotOfKey) {
+            size_t n = hashes.size();
+
+            // Keys grouped by bucket (counting sort)
+            std::vector<uint32_t> bucketStart(numBuckets + 1, 0);
+            for (uint64_t hash : hashes) {
+                ++bucketStart[bucketOf(hash, numBuckets) + 1];
+            }
+            for (size_t b = 0; b < numBuckets; ++b) {
+                bucketStart[b + 1] += bucketStart[b];
+            }
+            std::vector<uint32_t> keys(n);
+            std::vector<uint32_t> fill(bucketStart.begin(), bucketStart.end() - 1);
+            for (size_t key = 0; key < n; ++key) {
+                keys[fill[bucketOf(hashes[key], numBuckets)]++] = static_cast<uint32_t>(key);
+            }
+
+            // Largest buckets first, while the table is still mostly empty
+            std::vector<uint32_t> order(numBuckets);
+            for (size_t b = 0; b < numBuckets; ++b) {
+                order[b] = static_cast<uint32_t>(b);
+            }
+            std::stable_sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) {
+                return bucketStart[a + 1] - bucketStart[a] > bucketStart[b + 1] - bucketStart[b];
+            });
+
+            displacements.assign(numBuckets, 0);
+            slotOfKey.assign(n, 0);
+            std::vector<bool> taken(n, false);
+            std::vector<uint32_t> positions;
+            const uint64_t maxDisplacement = std::min<uint64_t>(UINT32_MAX, 64 * static_cast<uint64_t>(n) + 1024);
+
+            for (uint32_t bucket : order) {
+                uint32_t begin = bucketStart[bucket];
+                uint32_t end = bucketStart[bucket + 1];
+                if (begin == end) {
+                    break;   // Sorted by size: the rest are empty too
+                }
+                bool placed = false;
+                for (uint64_t d = 0; d < maxDisplacement && !placed; ++d) {
+                    positions.clear();
+                    placed = true;
+                    for (uint32_t i = begin; i < end; ++i) {
+                        uint32_t position = positionOf(hashes[keys[i]], static_cast<uint32_t>(d), n);
+                        if (taken[position] ||
+                            std::find(positions.begin(), positions.end(), position) != positions.end()) {
+                            placed = false;
+                            break;
+                        }
+                        positions.push_back(position);
+                    }
+                    if (placed) {
+                        displacements[bucket] = static_cast<uint32_t>(d);
+                        for (uint32_t i = begin; i < end; ++i) {
+                            taken[positions[i - begin]] = true;
+                            slotOfKey[keys[i]] = positions[i - begin];
+                        }
+                    }
+                }
+                if (!placed) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+    }
+
+    SentimentLexicon::SentimentLexicon(const std::vector<LexiconEntry>& entries, size_t negationWindow)
+    : seed_(0), negationWindow_(negationWindow) {
+        // Normalize every word the way scored text is normalized
+        std::string buffer;
+        std::vector<std::string_view> tokens;
+        std::vector<std::string> words;
+        words.reserve(entries.size());
+        for (const auto& entry : entries) {
+            TextProcessor::normalize(entry.word, buffer, tokens);
+            if (tokens.size() != 1 || tokens[0].size() > UINT16_MAX) {
+                throw std::invalid_argument("lexicon word must be a single token: " + std::string(entry.word));
+            }
+            words.emplace_back(tokens[0]);
+        }
+
+        std::vector<uint32_t> byWord(words.size());
+        for (size_t i = 0; i < byWord.size(); ++i) {
+            byWord[i] = static_cast<uint32_t>(i);
+        }
+        std::sort(byWord.begin(), byWord.end(), [&](uint32_t a, uint32_t b) { return words[a] < words[b]; });
+        for (size_t i = 1; i < byWord.size(); ++i) {
+            if (words[byWord[i - 1]] == words[byWord[i]]) {
+                throw std::invalid_argument("lexicon word listed twice: " + words[byWord[i]]);
+            }
+        }
+        if (words.empty()) {
+            return;
+        }
+
+        size_t numBuckets = (words.size() + kBucketSize - 1) / kBucketSize;
+        std::vector<uint64_t> hashes(words.size());
+        std::vector<uint32_t> slotOfKey;
+        bool built = false;
+        for (int attempt = 0; attempt < kMaxSeeds && !built; ++attempt) {
+            seed_ = hashMix(static_cast<uint64_t>(attempt) + 1);
+            for (size_t i = 0; i < words.size(); ++i) {
+                hashes[i] = hash64(words[i], seed_);
+            }
+            std::vector<uint64_t> sorted(hashes);
+            std::sort(sorted.begin(), sorted.end());
+            if (std::adjacent_find(sorted.begin(), sorted.end()) != sorted.end()) {
+                continue;
+            }
+            built = placeAll(hashes, numBuckets, displacements_, slotOfKey);
+        }
+        if (!built) {
+            throw std::runtime_error("failed to build the lexicon's perfect hash");
+        }
+
+        slots_.resize(words.size());
+        for (size_t i = 0; i < words.size(); ++i) {
+            Slot& slot = slots_[slotOfKey[i]];
+            slot.score = entries[i].score;
+            slot.offset = static_cast<uint32_t>(words_.size());
+            slot.length = static_cast<uint16_t>(words[i].size());
+            slot.negator = entries[i].negator;
+            words_ += words[i];
+        }
+    }
+
+    const SentimentLexicon& SentimentLexicon::builtin() {
+        static const SentimentLexicon lexicon(
+            std::vector<LexiconEntry>(std::begin(kBuiltinLexicon), std::end(kBuiltinLexicon)));
+        return lexicon;
+    }
+
+    std::optional<float> SentimentLexicon::find(std::string_view word) const {
+        uint32_t slot = lookup(word);
+        if (slot == kNotFound || slots_[slot].negator) {
+            return std::nullopt;
+        }
+        return slots_[slot].score;
+    }
+
+    bool SentimentLexicon::isNegator(std::string_view word) const {
+        uint32_t slot = lookup(word);
+        return slot != kNotFound && slots_[slot].negator;
+    }
+
+    SentimentScore SentimentLexicon::score(const std::vector<std::string_view>& tokens) const {
+        SentimentScore result;
+        result.tokens = tokens.size();
+        size_t negatedUntil = 0;   // Tokens before this index are negated
+        for (size_t i = 0; i < tokens.size(); ++i) {
+            uint32_t index = lookup(tokens[i]);
+            if (index == kNotFound) {
+                continue;
+            }
+            const Slot& slot = slots_[index];
+            if (slot.negator) {
+                negatedUntil = i + 1 + negationWindow_;
+                continue;
+            }
+            double value = i < negatedUntil ? -slot.score : slot.score;
+            result.score += value;
+            result.positive += value > 0;
+            result.negative += value < 0;
+        }
+        return result;
+    }
+
+    SentimentScore SentimentLexicon::score(std::string_view text, Scratch& scratch) const {
+        TextProcessor::normalize(text, scratch.buffer, scratch.tokens);
+        return score(scratch.tokens);
+    }
+
+    uint32_t SentimentLexicon::lookup(std::string_view word) const {
+        if (slots_.empty()) {
+            return kNotFound;
+        }
+        uint32_t index = slotOf(hash64(word, seed_));
+        const Slot& slot = slots_[index];
+        if (slot.length != word.size() || std::memcmp(words_.data() + slot.offset, word.data(), word.size()) != 0) {
+            return kNotFound;
+        }
+        return index;
+    }
+
+    uint32_t SentimentLexicon::slotOf(uint64_t hash) const {
+        return positionOf(hash, displacements_[bucketOf(hash, displacements_.size())], slots_.size());
+    }
+
+}
@@ -0,0 +1,439 @@
+#include "kinepredict/text_processing/TextProcessor.h"
+#include "kinepredict/core/Hash.h"
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <stdexcept>
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+namespace kinepredict {
+
+    namespace {
+
+        enum CharClass : uint8_t {
+            kSeparator,
+            kWord,
+            kApostrophe,
+            kSpace,         // Separator that charCount skips
+            kInvalid        // Byte that doesn't start a valid UTF-8 sequence
+        };
+
+        constexpr std::array<uint8_t, 256> makeClassTable() {
+            std::array<uint8_t, 256> table{};
+            for (int c = 0; c < 0x80; ++c) {
+                bool alnum = (c >= '0' && c <= '9') || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+                table[c] = alnum ? kWord : kSeparator;
+            }
+            for (int c = 0x80; c < 0x100; ++c) {
+                table[c] = kInvalid;   // Non-ASCII goes through decode()
+            }
+            for (char c : {' ', '\t', '\n', '\r', '\v', '\f'}) {
+                table[static_cast<unsigned char>(c)] = kSpace;
+            }
+            table['\''] = kApostrophe;
+            return table;
+        }
+
+        constexpr std::array<uint8_t, 256> kClass = makeClassTable();
+
+        // Maximum bytes the vector paths may store past the end of a run
+        constexpr size_t kSlack = 32;
+
+        struct CharInfo {
+            CharClass type;
+            uint8_t length;
+            uint32_t codePoint;
+        };
+
+        CharClass classifyCodePoint(uint32_t cp) {
+            if (cp == 0xA0 || (cp >= 0x2000 && cp <= 0x200A) || cp == 0x202F || cp == 0x205F || cp == 0x3000) {
+                return kSpace;
+            }
+            if (cp == 0x2019) {
+                return kApostrophe;
+            }
+            // C1 controls, Latin-1 symbols (except ª µ º), × ÷, general and CJK punctuation
+            bool latin1Symbol = cp >= 0x80 && cp <= 0xBF && cp != 0xAA && cp != 0xB5 && cp != 0xBA;
+            if (latin1Symbol || cp == 0xD7 || cp == 0xF7 ||
+                (cp >= 0x2000 && cp <= 0x206F) || (cp >= 0x3000 && cp <= 0x303F)) {
+                return kSeparator;
+            }
+            return kWord;
+        }
+
+        // Decode the character at text[i]; malformed UTF-8 yields kInvalid
+        // for one byte so the scan resynchronizes on the next
+        CharInfo decode(std::string_view text, size_t i) {
+            unsigned char lead = static_cast<unsigned char>(text[i]);
+            if (lead < 0x80) {
+                return {static_cast<CharClass>(kClass[lead]), 1, lead};
+            }
+
+            uint8_t length;
+            uint32_t cp;
+            uint32_t minimum;
+            if (lead >= 0xC2 && lead <= 0xDF) {
+                length = 2; cp = lead & 0x1F; minimum = 0x80;
+            } else if (lead >= 0xE0 && lead <= 0xEF) {
+                length = 3; cp = lead & 0x0F; minimum = 0x800;
+            } else if (lead >= 0xF0 && lead <= 0xF4) {
+                length = 4; cp = lead & 0x07; minimum = 0x10000;
+            } else {
+                return {kInvalid, 1, 0};
+            }
+
+            if (i + length > text.size()) {
+                return {kInvalid, 1, 0};
+            }
+            for (size_t k = 1; k < length; ++k) {
+                unsigned char next = static_cast<unsigned char>(text[i + k]);
+                if ((next & 0xC0) != 0x80) {
+                    return {kInvalid, 1, 0};
+                }
+                cp = (cp << 6) | (next & 0x3F);
+            }
+            if (cp < minimum || cp > 0x10FFFF || (cp >= 0xD800 && cp <= 0xDFFF)) {
+                return {kInvalid, 1, 0};   // Overlong, out of range or surrogate
+            }
+            return {classifyCodePoint(cp), length, cp};
+        }
+
+        // Simple case mapping for Latin-1, Latin Extended-A, Greek and Cyrillic
+        uint32_t lowerCodePoint(uint32_t cp) {
+            if (cp < 0x80) {
+                return cp >= 'A' && cp <= 'Z' ? cp + 0x20 : cp;
+            }
+            if (cp >= 0xC0 && cp <= 0xDE && cp != 0xD7) {
+                return cp + 0x20;
+            }
+            if (cp >= 0x100 && cp <= 0x17F) {
+                if (cp == 0x130) return 'i';    // İ
+                if (cp == 0x178) return 0xFF;   // Ÿ
+                if ((cp <= 0x137 && cp != 0x131) || (cp >= 0x14A && cp <= 0x177)) return cp | 1;
+                if ((cp >= 0x139 && cp <= 0x148) || (cp >= 0x179 && cp <= 0x17E)) return cp + (cp & 1);
+                return cp;
+            }
+            if (cp >= 0x391 && cp <= 0x3AB && cp != 0x3A2) {
+                return cp + 0x20;
+            }
+            if (cp >= 0x410 && cp <= 0x42F) {
+                return cp + 0x20;
+            }
+            if (cp >= 0x400 && cp <= 0x40F) {
+                return cp + 0x50;
+            }
+            return cp;
+        }
+
+        char* encode(uint32_t cp, char* out) {
+            if (cp < 0x80) {
+                *out++ = static_cast<char>(cp);
+            } else if (cp < 0x800) {
+                *out++ = static_cast<char>(0xC0 | (cp >> 6));
+                *out++ = static_cast<char>(0x80 | (cp & 0x3F));
+            } else if (cp < 0x10000) {
+                *out++ = static_cast<char>(0xE0 | (cp >> 12));
+                *out++ = static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+                *out++ = static_cast<char>(0x80 | (cp & 0x3F));
+            } else {
+                *out++ = static_cast<char>(0xF0 | (cp >> 18));
+                *out++ = static_cast<char>(0x80 | ((cp >> 12) & 0x3F));
+                *out++ = static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+                *out++ = static_cast<char>(0x80 | (cp & 0x3F));
+            }
+            return out;
+        }
+
+        bool isWordAt(std::string_view text, size_t i) {
+            return i < text.size() && decode(text, i).type == kWord;
+        }
+
+        // Find the next token at or after pos; false when none remain
+        bool nextToken(std::string_view text, size_t& pos, std::string_view& token) {
+            CharInfo c{kSeparator, 0, 0};
+            while (pos < text.size() && (c = decode(text, pos)).type != kWord) {
+                pos += c.length;
+            }
+            if (pos >= text.size()) return false;
+
+            size_t begin = pos;
+            while (pos < text.size()) {
+                c = decode(text, pos);
+                if (c.type == kWord || (c.type == kApostrophe && isWordAt(text, pos + c.length))) {
+                    pos += c.length;
+                } else {
+                    break;
+                }
+            }
+            token = text.substr(begin, pos - begin);
+            return true;
+        }
+
+        // Copy the run of ASCII letters/digits at src to dst, lowercased.
+        // Returns the run length; may store up to kSlack bytes past it.
+        size_t lowerAsciiRun(const char* src, size_t available, char* dst) {
+            size_t run = 0;
+#if defined(__AVX2__)
+            const __m256i beforeA = _mm256_set1_epi8('A' - 1), afterZ = _mm256_set1_epi8('Z' + 1);
+            const __m256i beforeLowerA = _mm256_set1_epi8('a' - 1), afterLowerZ = _mm256_set1_epi8('z' + 1);
+            const __m256i before0 = _mm256_set1_epi8('0' - 1), after9 = _mm256_set1_epi8('9' + 1);
+            const __m256i caseBit = _mm256_set1_epi8(0x20);
+            while (run + 32 <= available) {
+                // Signed compares: bytes >= 0x80 are negative and never match
+                __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + run));
+                __m256i upper = _mm256_and_si256(_mm256_cmpgt_epi8(v, beforeA), _mm256_cmpgt_epi8(afterZ, v));
+                __m256i lower = _mm256_and_si256(_mm256_cmpgt_epi8(v, beforeLowerA), _mm256_cmpgt_epi8(afterLowerZ, v));
+                __m256i digit = _mm256_and_si256(_mm256_cmpgt_epi8(v, before0), _mm256_cmpgt_epi8(after9, v));
+                __m256i word = _mm256_or_si256(_mm256_or_si256(upper, lower), digit);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + run),
+                                    _mm256_or_si256(v, _mm256_and_si256(upper, caseBit)));
+                uint32_t nonWord = ~static_cast<uint32_t>(_mm256_movemask_epi8(word));
+                if (nonWord != 0) {
+                    return run + __builtin_ctz(nonWord);
+                }
+                run += 32;
+            }
+#endif
+#if defined(__SSE2__)
+            const __m128i beforeA16 = _mm_set1_epi8('A' - 1), afterZ16 = _mm_set1_epi8('Z' + 1);
+            const __m128i beforeLowerA16 = _mm_set1_epi8('a' - 1), afterLowerZ16 = _mm_set1_epi8('z' + 1);
+            const __m128i before016 = _mm_set1_epi8('0' - 1), after916 = _mm_set1_epi8('9' + 1);
+            const __m128i caseBit16 = _mm_set1_epi8(0x20);
+            while (run + 16 <= available) {
+                __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + run));
+                __m128i upper = _mm_and_si128(_mm_cmpgt_epi8(v, beforeA16), _mm_cmpgt_epi8(afterZ16, v));
+                __m128i lower = _mm_and_si128(_mm_cmpgt_epi8(v, beforeLowerA16), _mm_cmpgt_epi8(afterLowerZ16, v));
+                __m128i digit = _mm_and_si128(_mm_cmpgt_epi8(v, before016), _mm_cmpgt_epi8(after916, v));
+                __m128i word = _mm_or_si128(_mm_or_si128(upper, lower), digit);
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + run),
+                                 _mm_or_si128(v, _mm_and_si128(upper, caseBit16)));
+                uint32_t nonWord = ~static_cast<uint32_t>(_mm_movemask_epi8(word)) & 0xFFFF;
+                if (nonWord != 0) {
+                    return run + __builtin_ctz(nonWord);
+                }
+                run += 16;
+            }
+#endif
+            while (run < available) {
+                unsigned char c = static_cast<unsigned char>(src[run]);
+                if (kClass[c] != kWord) break;
+                dst[run] = static_cast<char>(c >= 'A' && c <= 'Z' ? c + 0x20 : c);
+                ++run;
+            }
+            return run;
+        }
+
+    }
+
+    void TextProcessor::tokenize(std::string_view text, std::vector<std::string_view>& tokens) {
+        tokens.clear();
+        size_t pos = 0;
+        std::string_view token;
+        while (nextToken(text, pos, token)) {
+            tokens.push_back(token);
+        }
+    }
+
+    std::vector<std::string_view> TextProcessor::tokenize(std::string_view text) {
+        std::vector<std::string_view> tokens;
+        tokenize(text, tokens);
+        return tokens;
+    }
+
+    void TextProcessor::normalize(std::string_view text, std::string& buffer,
+                                  std::vector<std::string_view>& tokens) {
+        tokens.clear();
+
+        // Output never outgrows the input: lowercase mappings keep or
+        // shrink byte length and separators collapse to one space. The
+        // slack absorbs vector stores, so buffer never reallocates and
+        // views taken during the pass stay valid.
+        buffer.resize(text.size() + kSlack);
+        char* const base = &buffer[0];
+        char* out = base;
+        char* tokenStart = nullptr;
+
+        auto startToken = [&] {
+            if (!tokens.empty()) *out++ = ' ';
+            tokenStart = out;
+        };
+        auto endToken = [&] {
+            tokens.emplace_back(tokenStart, static_cast<size_t>(out - tokenStart));
+            tokenStart = nullptr;
+        };
+
+        size_t pos = 0;
+        while (pos < text.size()) {
+            unsigned char lead = static_cast<unsigned char>(text[pos]);
+            if (kClass[lead] == kWord) {
+                if (!tokenStart) startToken();
+                size_t run = lowerAsciiRun(text.data() + pos, text.size() - pos, out);
+                pos += run;
+                out += run;
+                continue;
+            }
+
+            CharInfo c = decode(text, pos);
+            if (c.type == kWord) {
+                if (!tokenStart) startToken();
+                out = encode(lowerCodePoint(c.codePoint), out);
+            } else if (c.type == kApostrophe && tokenStart && isWordAt(text, pos + c.length)) {
+                *out++ = '\'';
+            } else if (tokenStart) {
+                endToken();   // Separators, spaces, invalid bytes and stray apostrophes
+            }
+            pos += c.length;
+        }
+        if (tokenStart) endToken();
+
+        buffer.resize(static_cast<size_t>(out - base));
+    }
+
+    std::string TextProcessor::toLowerCase(std::string_view text) {
+        std::string result;
+        result.reserve(text.size());
+        char scratch[4];
+        for (size_t pos = 0; pos < text.size();) {
+            CharInfo c = decode(text, pos);
+            if (c.type == kInvalid) {
+                result.push_back(text[pos]);   // Preserve bytes we can't interpret
+            } else {
+                result.append(scratch, encode(lowerCodePoint(c.codePoint), scratch));
+            }
+            pos += c.length;
+        }
+        return result;
+    }
+
+    std::string TextProcessor::removePunctuation(std::string_view text) {
+        std::string result;
+        result.reserve(text.size());
+        bool afterWord = false;
+        bool splitWord = false;  // Dropped characters ended a word
+        for (size_t pos = 0; pos < text.size();) {
+            CharInfo c = decode(text, pos);
+            bool keep = c.type == kWord || c.type == kSpace ||
+                        (c.type == kApostrophe && afterWord && isWordAt(text, pos + c.length));
+            if (keep) {
+                // Dropped characters between two words still separate them
+                if (splitWord && c.type == kWord) {
+                    result.push_back(' ');
+                }
+                splitWord = false;
+                result.append(text.substr(pos, c.length));
+            } else {
+                splitWord = splitWord || afterWord;
+            }
+            afterWord = c.type == kWord || (keep && c.type == kApostrophe);
+            pos += c.length;
+        }
+        return result;
+    }
+
+    std::vector<std::string> TextProcessor::extractNGrams(
+        const std::vector<std::string_view>& tokens, size_t n) {
+        std::vector<std::string> ngrams;
+        if (n == 0 || tokens.size() < n) {
+            return ngrams;
+        }
+        ngrams.reserve(tokens.size() - n + 1);
+        for (size_t start = 0; start + n <= tokens.size(); ++start) {
+            std::string gram(tokens[start]);
+            for (size_t i = start + 1; i < start + n; ++i) {
+                gram.push_back(' ');
+                gram.append(tokens[i]);
+            }
+            ngrams.push_back(std::move(gram));
+        }
+        return ngrams;
+    }
+
+    namespace {
+
+        void checkNGramRange(size_t minN, size_t maxN) {
+            if (minN == 0 || minN > maxN) {
+                throw std::invalid_argument("n-gram range must satisfy 1 <= minN <= maxN");
+            }
+            if (maxN > TextProcessor::kMaxHashedNGram) {
+                throw std::invalid_argument("maxN exceeds TextProcessor::kMaxHashedNGram");
+            }
+        }
+
+        // Calls emit(id) for every gram of length minN..maxN, by end token.
+        // rolling[n - 1] holds the hash of the n-gram ending at the current
+        // token; extending each by the next token gives the (n + 1)-grams
+        // ending there, so every token is hashed exactly once.
+        template<typename Emit>
+        void forEachNGramHash(const std::vector<std::string_view>& tokens,
+                              size_t minN, size_t maxN, Emit emit) {
+            std::array<uint64_t, TextProcessor::kMaxHashedNGram> rolling{};
+            for (size_t end = 0; end < tokens.size(); ++end) {
+                uint64_t tokenHash = hash64(tokens[end]);
+                size_t longest = std::min(maxN, end + 1);
+                for (size_t n = longest; n > 1; --n) {
+                    rolling[n - 1] = hashCombine(rolling[n - 2], tokenHash);
+                }
+                rolling[0] = tokenHash;
+                for (size_t n = minN; n <= longest; ++n) {
+                    emit(rolling[n - 1]);
+                }
+            }
+        }
+
+        size_t nGramCount(size_t tokenCount, size_t minN, size_t maxN) {
+            size_t count = 0;
+            for (size_t n = minN; n <= maxN && n <= tokenCount; ++n) {
+                count += tokenCount - n + 1;
+            }
+            return count;
+        }
+
+    }
+
+    void TextProcessor::hashNGrams(const std::vector<std::string_view>& tokens,
+                                   size_t minN, size_t maxN, std::vector<uint64_t>& ids) {
+        checkNGramRange(minN, maxN);
+        ids.clear();
+        ids.reserve(nGramCount(tokens.size(), minN, maxN));
+        forEachNGramHash(tokens, minN, maxN, [&](uint64_t id) { ids.push_back(id); });
+    }
+
+    void TextProcessor::hashNGrams(const std::vector<std::string_view>& tokens,
+                                   size_t minN, size_t maxN, uint32_t numBuckets,
+                                   std::vector<uint32_t>& buckets) {
+        checkNGramRange(minN, maxN);
+        if (numBuckets == 0) {
+            throw std::invalid_argument("numBuckets must be positive");
+        }
+        buckets.clear();
+        buckets.reserve(nGramCount(tokens.size(), minN, maxN));
+        forEachNGramHash(tokens, minN, maxN, [&](uint64_t id) {
+            // Multiply-shift range reduction on the high bits instead of a modulo
+            buckets.push_back(static_cast<uint32_t>(((id >> 32) * numBuckets) >> 32));
+        });
+    }
+
+    size_t TextProcessor::wordCount(std::string_view text) {
+        size_t count = 0;
+        size_t pos = 0;
+        std::string_view token;
+        while (nextToken(text, pos, token)) {
+            ++count;
+        }
+        return count;
+    }
+
+    size_t TextProcessor::charCount(std::string_view text) {
+        size_t count = 0;
+        for (size_t pos = 0; pos < text.size();) {
+            CharInfo c = decode(text, pos);
+            count += c.type != kSpace && c.type != kInvalid;
+            pos += c.length;
+        }
+        return count;
+    }
+
+}
@@ -0,0 +1,261 @@
+#include "kinepredict/text_processing/TfidfVectorizer.h"
+#include "kinepredict/text_processing/TextProcessor.h"
+#include <algorithm>
+#include <cmath>
+#include <exception>
+#include <stdexcept>
+#include <thread>
+#include <unordered_map>
+
+namespace kinepredict {
+
+    namespace {
+
+        using TermCounts = std::unordered_map<uint64_t, uint32_t>;
+
+        // Term-hash partitions per worker in fit(); fixed so the table
+        // count grows linearly with the thread count
+        constexpr size_t kPartitions = 64;
+
+        size_t resolveThreads(size_t numThreads, size_t work) {
+            if (numThreads == 0) {
+                numThreads = std::max(1u, std::thread::hardware_concurrency());
+            }
+            return std::max<size_t>(1, std::min(numThreads, work));
+        }
+
+        // Splits [0, count) into one contiguous range per worker and calls
+        // fn(worker, begin, end); the calling thread is worker 0. Every
+        // thread is joined before the first exception from fn is rethrown.
+        template<typename Fn>
+        void forEachRange(size_t count, size_t numWorkers, Fn fn) {
+            size_t perWorker = (count + numWorkers - 1) / numWorkers;
+            std::vector<std::exception_ptr> errors(numWorkers);
+            auto runWorker = [&](size_t worker) {
+                try {
+                    size_t begin = std::min(count, worker * perWorker);
+                    fn(worker, begin, std::min(count, begin + perWorker));
+                } catch (...) {
+                    errors[worker] = std::current_exception();
+                }
+            };
+            std::vector<std::thread> threads;
+            auto joinAll = [&threads] {
+                for (auto& thread : threads) {
+                    thread.join();
+                }
+            };
+            try {
+                for (size_t worker = 1; worker < numWorkers; ++worker) {
+                    threads.emplace_back(runWorker, worker);
+                }
+            } catch (...) {
+                joinAll();
+                throw;
+            }
+            runWorker(0);
+            joinAll();
+            for (const auto& error : errors) {
+                if (error) {
+                    std::rethrow_exception(error);
+                }
+            }
+        }
+
+    }
+
+    TfidfVectorizer::TfidfVectorizer(size_t maxNGram, size_t minDocumentFrequency, size_t maxFeatures)
+    : maxNGram_(maxNGram), minDocumentFrequency_(minDocumentFrequency), maxFeatures_(maxFeatures),
+      documentCount_(0) {
+        if (maxNGram == 0 || maxNGram > TextProcessor::kMaxHashedNGram) {
+            throw std::invalid_argument("maxNGram must be in 1..TextProcessor::kMaxHashedNGram");
+        }
+    }
+
+    void TfidfVectorizer::fit(const std::vector<std::string_view>& documents, size_t numThreads) {
+        size_t numWorkers = resolveThreads(numThreads, documents.size());
+
+        // tables[worker][partition]: each worker counts into its own tables,
+        // split by term hash so partitions can be merged independently
+        std::vector<std::vector<TermCounts>> tables(numWorkers, std::vector<TermCounts>(kPartitions));
+        auto partitionOf = [](uint64_t term) {
+            return static_cast<size_t>(((term >> 32) * kPartitions) >> 32);
+        };
+
+        forEachRange(documents.size(), numWorkers, [&](size_t worker, size_t begin, size_t end) {
+            Scratch scratch;
+            std::vector<TermCounts>& local = tables[worker];
+            for (size_t i = begin; i < end; ++i) {
+                terms(documents[i], scratch);
+                std::sort(scratch.terms.begin(), scratch.terms.end());
+                auto last = std::unique(scratch.terms.begin(), scratch.terms.end());
+                for (auto term = scratch.terms.begin(); term != last; ++term) {
+                    ++local[partitionOf(*term)][*term];
+                }
+            }
+        });
+
+        // Merge each partition across workers, spreading partitions over
+        // the workers, and keep the terms that pass the frequency floor
+        std::vector<std::vector<std::pair<uint32_t, uint64_t>>> kept(kPartitions);
+        forEachRange(kPartitions, numWorkers, [&](size_t, size_t begin, size_t end) {
+            for (size_t p = begin; p < end; ++p) {
+                TermCounts& merged = tables[0][p];
+                for (size_t worker = 1; worker < numWorkers; ++worker) {
+                    for (const auto& [term, count] : tables[worker][p]) {
+                        merged[term] += count;
+                    }
+                    TermCounts().swap(tables[worker][p]);
+                }
+                for (const auto& [term, count] : merged) {
+                    if (count >= minDocumentFrequency_) {
+                        kept[p].emplace_back(count, term);
+                    }
+                }
+                TermCounts().swap(merged);
+            }
+        });
+
+        std::vector<std::pair<uint32_t, uint64_t>> vocabulary;
+        for (auto& partition : kept) {
+            vocabulary.insert(vocabulary.end(), partition.begin(), partition.end());
+        }
+        // Most frequent first; ties by hash so the order is deterministic
+        std::sort(vocabulary.begin(), vocabulary.end(), [](const auto& a, const auto& b) {
+            return a.first != b.first ? a.first > b.first : a.second < b.second;
+        });
+        if (maxFeatures_ != 0 && vocabulary.size() > maxFeatures_) {
+            vocabulary.resize(maxFeatures_);
+        }
+
+        documentCount_ = documents.size();
+        idf_.resize(vocabulary.size());
+        documentFrequency_.resize(vocabulary.size());
+        size_t capacity = 2;
+        while (capacity < vocabulary.size() * 2) {
+            capacity <<= 1;
+        }
+        slots_.assign(capacity, Slot{0, kEmpty});
+        for (size_t column = 0; column < vocabulary.size(); ++column) {
+            auto [df, term] = vocabulary[column];
+            documentFrequency_[column] = df;
+            idf_[column] = static_cast<float>(std::log((1.0 + documentCount_) / (1.0 + df)) + 1.0);
+            size_t slot = term & (capacity - 1);
+            while (slots_[slot].column != kEmpty) {
+                slot = (slot + 1) & (capacity - 1);
+            }
+            slots_[slot] = Slot{term, static_cast<uint32_t>(column)};
+        }
+    }
+
+    void TfidfVectorizer::transform(std::string_view text, Scratch& scratch,
+                                    std::vector<uint32_t>& columns, std::vector<float>& values) const {
+        columns.clear();
+        values.clear();
+        terms(text, scratch);
+
+        scratch.columns.clear();
+        for (uint64_t term : scratch.terms) {
+            uint32_t column = lookup(term);
+            if (column != kEmpty) {
+                scratch.columns.push_back(column);
+            }
+        }
+        std::sort(scratch.columns.begin(), scratch.columns.end());
+
+        // Runs of equal columns give the term counts
+        double squaredNorm = 0.0;
+        for (size_t i = 0; i < scratch.columns.size();) {
+            uint32_t column = scratch.columns[i];
+            size_t run = i;
+            while (run < scratch.columns.size() && scratch.columns[run] == column) {
+                ++run;
+            }
+            float weight = static_cast<float>(run - i) * idf_[column];
+            columns.push_back(column);
+            values.push_back(weight);
+            squaredNorm += static_cast<double>(weight) * weight;
+            i = run;
+        }
+        if (squaredNorm > 0.0) {
+            float scale = static_cast<float>(1.0 / std::sqrt(squaredNorm));
+            for (float& value : values) {
+                value *= scale;
+            }
+        }
+    }
+
+    SparseMatrix TfidfVectorizer::transform(const std::vector<std::string_view>& documents,
+                                            size_t numThreads) const {
+        size_t numWorkers = resolveThreads(numThreads, documents.size());
+
+        // Each worker fills a CSR block for its range; blocks are then
+        // concatenated in order with shifted offsets
+        std::vector<SparseMatrix> blocks(numWorkers);
+        forEachRange(documents.size(), numWorkers, [&](size_t worker, size_t begin, size_t end) {
+            SparseMatrix& block = blocks[worker];
+            Scratch scratch;
+            std::vector<uint32_t> columns;
+            std::vector<float> values;
+            block.rowOffsets.reserve(end - begin + 1);
+            for (size_t i = begin; i < end; ++i) {
+                transform(documents[i], scratch, columns, values);
+                block.indices.insert(block.indices.end(), columns.begin(), columns.end());
+                block.values.insert(block.values.end(), values.begin(), values.end());
+                block.rowOffsets.push_back(block.indices.size());
+            }
+        });
+
+        SparseMatrix result;
+        result.numColumns = vocabularySize();
+        size_t nonZeros = 0;
+        for (const auto& block : blocks) {
+            nonZeros += block.nonZeros();
+        }
+        result.rowOffsets.reserve(documents.size() + 1);
+        result.indices.reserve(nonZeros);
+        result.values.reserve(nonZeros);
+        for (const auto& block : blocks) {
+            size_t base = result.indices.size();
+            for (size_t row = 1; row < block.rowOffsets.size(); ++row) {
+                result.rowOffsets.push_back(base + block.rowOffsets[row]);
+            }
+            result.indices.insert(result.indices.end(), block.indices.begin(), block.indices.end());
+            result.values.insert(result.values.end(), block.values.begin(), block.values.end());
+        }
+        return result;
+    }
+
+    std::optional<uint32_t> TfidfVectorizer::termColumn(std::string_view term) const {
+        Scratch scratch;
+        TextProcessor::normalize(term, scratch.buffer, scratch.tokens);
+        size_t n = scratch.tokens.size();
+        if (n == 0 || n > maxNGram_) {
+            return std::nullopt;
+        }
+        TextProcessor::hashNGrams(scratch.tokens, n, n, scratch.terms);
+        uint32_t column = lookup(scratch.terms[0]);
+        if (column == kEmpty) {
+            return std::nullopt;
+        }
+        return column;
+    }
+
+    uint32_t TfidfVectorizer::lookup(uint64_t term) const {
+        if (slots_.empty()) {
+            return kEmpty;
+        }
+        size_t mask = slots_.size() - 1;
+        for (size_t slot = term & mask;; slot = (slot + 1) & mask) {
+            if (slots_[slot].column == kEmpty || slots_[slot].term == term) {
+                return slots_[slot].column;
+            }
+        }
+    }
+
+    void TfidfVectorizer::terms(std::string_view text, Scratch& scratch) const {
+        TextProcessor::normalize(text, scratch.buffer, scratch.tokens);
+        TextProcessor::hashNGrams(scratch.tokens, 1, maxNGram_, scratch.terms);
+    }
+
+}
@@ -0,0 +1,155 @@
+#include "kinepredict/data_structures/Trie.h"
+#include "kinepredict/data_structures/AhoCorasick.h"
+#include <iostream>
+#include <cassert>
+#include <random>
+
+using namespace kinepredict;
+
+// Reference: test every substring against the dictionary
+std::vector<AhoCorasick::Match> bruteForce(const Trie& trie, const std::string& text) {
+    std::vector<AhoCorasick::Match> matches;
+    for (size_t end = 1; end <= text.size(); end++) {
+        for (size_t start = 0; start < end; start++) {
+            if (trie.search(text.substr(start, end - start))) {
+                matches.push_back({start, end - start});
+            }
+        }
+    }
+    return matches;
+}
+
+void testAhoCorasickBasic() {
+    Trie trie;
+    trie.insert("he");
+    trie.insert("she");
+    trie.insert("his");
+    trie.insert("hers");
+    
+    AhoCorasick automaton(trie);
+    assert(automaton.patternCount() == 4);
+    
+    // Overlapping matches via output links: "she" and "he" end together
+    auto matches = automaton.findAll("ushers");
+    std::vector<AhoCorasick::Match> expected = {{1, 3}, {2, 2}, {2, 4}};
+    assert(matches == expected);
+    
+    assert(automaton.findAll("").empty());
+    assert(automaton.findAll("xyz").empty());
+    assert(automaton.containsAny("this") == true);
+    assert(automaton.containsAny("that") == false);
+    
+    std::cout << "✓ Aho-Corasick basic test passed" << std::endl;
+}
+
+void testAhoCorasickPhrases() {
+    Trie trie;
+    trie.insert("buy now");
+    trie.insert("now");
+    trie.insert("50% off");
+    trie.insert("free");
+    
+    AhoCorasick automaton(trie);
+    
+    // Matches spanning token boundaries and punctuation
+    std::string text = "Buy now: 50% off, buy now and get it free!";
+    auto matches = automaton.findAll(text);
+    std::vector<std::string> found;
+    for (const auto& match : matches) {
+        found.push_back(text.substr(match.position, match.length));
+    }
+    std::vector<std::string> expected = {"now", "50% off", "buy now", "now", "free"};
+    assert(found == expected);
+    
+    std::cout << "✓ Aho-Corasick phrase test passed" << std::endl;
+}
+
+void testAhoCorasickMatchesBruteForce() {
+    // Small alphabet so keywords overlap and failure chains get deep
+    std::mt19937 rng(7);
+    std::uniform_int_distribution<int> letter('a', 'c');
+    std::uniform_int_distribution<int> length(1, 6);
+    
+    Trie trie;
+    for (int i = 0; i < 60; i++) {
+        std::string word;
+        int len = length(rng);
+        for (int j = 0; j < len; j++) word.push_back(static_cast<char>(letter(rng)));
+        trie.insert(word);
+    }
+    AhoCorasick automaton(trie);
+    
+    for (int doc = 0; doc < 50; doc++) {
+        std::string text;
+        for (int j = 0; j < 200; j++) text.push_back(static_cast<char>(letter(rng)));
+        
+        auto expected = bruteForce(trie, text);
+        // Brute force lists longest-first per end; the automaton walks the
+        // output chain from the longest match too
+        assert(automaton.findAll(text) == expected);
+    }
+    
+    std::cout << "✓ Aho-Corasick matches brute force test passed" << std::endl;
+}
+
+void testAhoCorasickBatch() {
+    Trie trie;
+    trie.insert("sale");
+    trie.insert("discount");
+    trie.insert("count");
+    
+    AhoCorasick automaton(trie);
+    
+    std::vector<std::string> owned;
+    for (int i = 0; i < 100; i++) {
+        owned.push_back(i % 3 == 0 ? "big discount sale #" + std::to_string(i) : "nothing here");
+    }
+    std::vector<std::string_view> documents(owned.begin(), owned.end());
+    
+    auto serial = automaton.findAllBatch(documents);
+    auto parallel = automaton.findAllBatch(documents, 4);
+    assert(serial.size() == documents.size());
+    assert(serial == parallel);
+    
+    for (size_t i = 0; i < documents.size(); i++) {
+        assert(serial[i] == automaton.findAll(documents[i]));
+        assert(serial[i].size() == (i % 3 == 0 ? 3u : 0u));
+    }
+    
+    assert(automaton.findAllBatch({}, 4).empty());
+    
+    std::cout << "✓ Aho-Corasick batch test passed" << std::endl;
+}
+
+void testAhoCorasickIndependentOfTrie() {
+    Trie trie;
+    trie.insert("alpha");
+    AhoCorasick automaton(trie);
+    
+    // The automaton is a copy; later trie changes don't affect it
+    trie.insert("beta");
+    trie.clear();
+    
+    assert(automaton.patternCount() == 1);
+    assert(automaton.containsAny("alphabet"));
+    assert(!automaton.containsAny("beta"));
+    
+    Trie empty;
+    AhoCorasick none(empty);
+    assert(none.findAll("anything").empty());
+    
+    std::cout << "✓ Aho-Corasick independence test passed" << std::endl;
+}
+
+int main() {
+    std::cout << "Running Aho-Corasick tests..." << std::endl;
+    
+    testAhoCorasickBasic();
+    testAhoCorasickPhrases();
+    testAhoCorasickMatchesBruteForce();
+    testAhoCorasickBatch();
+    testAhoCorasickIndependentOfTrie();
+    
+    std::cout << "\n✅ All Aho-Corasick tests passed!" << std::endl;
+    return 0;
+}
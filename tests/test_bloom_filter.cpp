@@ -1,4 +1,5 @@
 #include "kinepredict/data_structures/BloomFilter.h"
+#include "kinepredict/core/Hash.h"
 #include <iostream>
 #include <cassert>
 
@@ -46,11 +47,144 @@ void testBloomFilterFalsePositive() {
     std::cout << "✓ Bloom Filter false positive test passed" << std::endl;
 }
 
+void testBlockedBloomFilterBasic() {
+    BloomFilter bloom(100, 0.01, BloomFilter::Layout::Blocked);
+    
+    assert(bloom.getLayout() == BloomFilter::Layout::Blocked);
+    
+    bloom.add("marketing");
+    bloom.add("content");
+    bloom.add("prediction");
+    
+    assert(bloom.contains("marketing") == true);
+    assert(bloom.contains("content") == true);
+    assert(bloom.contains("prediction") == true);
+    assert(bloom.contains("nonexistent") == false);
+    
+    bloom.clear();
+    assert(bloom.contains("marketing") == false);
+    assert(bloom.getFalsePositiveRate() == 0.0);
+    
+    std::cout << "✓ Blocked Bloom Filter basic test passed" << std::endl;
+}
+
+void testBlockedBloomFilterFalsePositive() {
+    const int inserted = 10000;
+    const int testCases = 100000;
+    
+    BloomFilter standard(inserted, 0.01);
+    BloomFilter blocked(inserted, 0.01, BloomFilter::Layout::Blocked);
+    
+    for (int i = 0; i < inserted; i++) {
+        standard.add("item" + std::to_string(i));
+        blocked.add("item" + std::to_string(i));
+    }
+    
+    // No false negatives
+    for (int i = 0; i < inserted; i++) {
+        assert(blocked.contains("item" + std::to_string(i)));
+    }
+    
+    int standardPositives = 0;
+    int blockedPositives = 0;
+    for (int i = inserted; i < inserted + testCases; i++) {
+        std::string key = "item" + std::to_string(i);
+        standardPositives += standard.contains(key);
+        blockedPositives += blocked.contains(key);
+    }
+    
+    double standardRate = static_cast<double>(standardPositives) / testCases;
+    double blockedRate = static_cast<double>(blockedPositives) / testCases;
+    std::cout << "  Standard FPR: measured " << standardRate
+              << ", theoretical " << standard.getFalsePositiveRate() << std::endl;
+    std::cout << "  Blocked FPR:  measured " << blockedRate
+              << ", theoretical " << blocked.getFalsePositiveRate() << std::endl;
+    
+    // Blocking costs some accuracy, but it should stay in the same ballpark
+    assert(blocked.getFalsePositiveRate() >= standard.getFalsePositiveRate());
+    assert(blockedRate < 0.05);
+    
+    std::cout << "✓ Blocked Bloom Filter false positive test passed" << std::endl;
+}
+
+void testBloomFilterBatch() {
+    for (auto layout : {BloomFilter::Layout::Standard, BloomFilter::Layout::Blocked}) {
+        BloomFilter batched(1000, 0.01, layout);
+        BloomFilter single(1000, 0.01, layout);
+        
+        std::vector<std::string> keys;
+        for (int i = 0; i < 150; i++) {
+            keys.push_back("headline" + std::to_string(i));
+        }
+        keys.push_back("headline7");  // Repeat inside the batch
+        
+        std::vector<std::string_view> views(keys.begin(), keys.end());
+        auto added = batched.addBatch(views);
+        assert(added.size() == 3);
+        assert(added[2] & (uint64_t(1) << (150 - 128)));  // Repeat is flagged
+        
+        for (const auto& key : keys) single.add(key);
+        
+        std::vector<std::string> probes = {"headline3", "headline149", "missing-a", "missing-b"};
+        std::vector<std::string_view> probeViews(probes.begin(), probes.end());
+        auto found = batched.containsBatch(probeViews);
+        assert(found.size() == 1);
+        
+        for (size_t i = 0; i < probes.size(); i++) {
+            bool bit = (found[0] >> i) & 1;
+            assert(bit == batched.contains(probes[i]));
+            assert(bit == single.contains(probes[i]));
+        }
+        assert((found[0] & 0x3) == 0x3);
+        
+        assert(batched.containsBatch({}).empty());
+    }
+    
+    std::cout << "✓ Bloom Filter batch test passed" << std::endl;
+}
+
+void testBloomFilterHashed() {
+    BloomFilter bloom(1000, 0.01);
+    
+    for (uint64_t i = 0; i < 1000; i++) {
+        bloom.addHashed(hashMix(i));
+    }
+    for (uint64_t i = 0; i < 1000; i++) {
+        assert(bloom.containsHashed(hashMix(i)) == true);
+    }
+    
+    int falsePositives = 0;
+    int testCases = 10000;
+    for (uint64_t i = 1000; i < 1000 + static_cast<uint64_t>(testCases); i++) {
+        falsePositives += bloom.containsHashed(hashMix(i));
+    }
+    double actualRate = static_cast<double>(falsePositives) / testCases;
+    std::cout << "  Hashed false positive rate: " << actualRate << std::endl;
+    assert(actualRate < 0.05);
+    
+    // Sequential, low-entropy IDs are spread by the derived second hash
+    BloomFilter sequential(1000, 0.01, BloomFilter::Layout::Blocked);
+    for (uint64_t i = 0; i < 1000; i++) {
+        sequential.addHashed(i);
+    }
+    falsePositives = 0;
+    for (uint64_t i = 1000; i < 1000 + static_cast<uint64_t>(testCases); i++) {
+        falsePositives += sequential.containsHashed(i);
+    }
+    assert(static_cast<double>(falsePositives) / testCases < 0.05);
+    
+    std::cout << "✓ Bloom Filter hashed keys test passed" << std::endl;
+}
+
 int main() {
     std::cout << "Running Bloom Filter tests..." << std::endl;
     
     testBloomFilterBasic();
     testBloomFilterFalsePositive();
+    testBlockedBloomFilterBasic();
+    testBlockedBloomFilterFalsePositive();
+    testBloomFilterBatch();
+    testBloomFilterHashed();
     
     std::cout << "\n✅ All Bloom Filter tests passed!" << std::endl;
     return 0;
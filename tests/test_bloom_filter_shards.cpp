@@ -0,0 +1,228 @@
+#include "kinepredict/data_structures/BloomFilter.h"
+#include "kinepredict/data_structures/BloomFilterView.h"
+#include <iostream>
+#include <cassert>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <cstdio>
+#include <cstring>
+#include <sys/wait.h>
+#include <unistd.h>
+
+using namespace kinepredict;
+
+namespace {
+
+// Keyed by the test's pid, captured before forking the node processes
+const pid_t testPid = ::getpid();
+
+std::string shardPath(int node) {
+    return "/tmp/kinepredict_shard_" + std::to_string(testPid) + "_" + std::to_string(node) + ".kpbf";
+}
+
+std::string nodeKey(int node, int i) {
+    return "node" + std::to_string(node) + "-headline" + std::to_string(i);
+}
+
+// Header field offsets in the shard format (see BloomFilter::serialize)
+constexpr size_t kVersionOffset = 4;
+constexpr size_t kLayoutOffset = 8;
+constexpr size_t kHashFunctionsOffset = 12;
+constexpr size_t kBitArraySizeOffset = 16;
+constexpr size_t kNumBlocksOffset = 24;
+
+template<typename T>
+std::string patched(std::string shard, size_t offset, T value) {
+    std::memcpy(&shard[offset], &value, sizeof(value));
+    return shard;
+}
+
+bool deserializeThrows(const std::string& shard) {
+    std::stringstream in(shard);
+    try {
+        BloomFilter::deserialize(in);
+    } catch (const std::runtime_error&) {
+        return true;
+    }
+    return false;
+}
+
+} // namespace
+
+void testBloomFilterSerializeRoundTrip() {
+    for (auto layout : {BloomFilter::Layout::Standard, BloomFilter::Layout::Blocked}) {
+        BloomFilter bloom(1000, 0.01, layout);
+        for (int i = 0; i < 500; i++) {
+            bloom.add("item" + std::to_string(i));
+        }
+        
+        std::stringstream buffer;
+        bloom.serialize(buffer);
+        
+        BloomFilter loaded = BloomFilter::deserialize(buffer);
+        assert(loaded.getLayout() == layout);
+        assert(loaded.getElementCount() == 500);
+        for (int i = 0; i < 2000; i++) {
+            std::string key = "item" + std::to_string(i);
+            assert(loaded.contains(key) == bloom.contains(key));
+        }
+    }
+    
+    std::stringstream garbage("definitely not a bloom filter shard, but long enough to have a header......");
+    bool threw = false;
+    try {
+        BloomFilter::deserialize(garbage);
+    } catch (const std::runtime_error&) {
+        threw = true;
+    }
+    assert(threw);
+    
+    std::cout << "✓ Bloom Filter serialize round-trip test passed" << std::endl;
+}
+
+void testBloomFilterDeserializeRejectsBadShards() {
+    BloomFilter bloom(1000, 0.01, BloomFilter::Layout::Blocked);
+    bloom.add("headline");
+    std::stringstream buffer;
+    bloom.serialize(buffer);
+    const std::string shard = buffer.str();
+    assert(!deserializeThrows(shard));
+    
+    // Truncated in the header, at the first word, and one byte short
+    assert(deserializeThrows(shard.substr(0, 10)));
+    assert(deserializeThrows(shard.substr(0, 64)));
+    assert(deserializeThrows(shard.substr(0, shard.size() - 1)));
+    
+    // Garbage header fields
+    assert(deserializeThrows(patched<uint32_t>(shard, kVersionOffset, 99)));
+    assert(deserializeThrows(patched<uint32_t>(shard, kLayoutOffset, 7)));
+    assert(deserializeThrows(patched<uint32_t>(shard, kHashFunctionsOffset, 0)));
+    assert(deserializeThrows(patched<uint32_t>(shard, kHashFunctionsOffset, 0xFFFFFFFF)));
+    assert(deserializeThrows(patched<uint64_t>(shard, kBitArraySizeOffset, 0)));
+    assert(deserializeThrows(patched<uint64_t>(shard, kNumBlocksOffset, 0)));
+    assert(deserializeThrows(patched<uint64_t>(shard, kNumBlocksOffset, UINT64_MAX)));
+    assert(deserializeThrows(patched<uint64_t>(shard, kNumBlocksOffset, UINT64_MAX / 64 + 1)));
+    
+    // A consistent header claiming a huge filter fails on the short read,
+    // without first allocating the claimed size
+    std::string huge = patched<uint64_t>(shard, kBitArraySizeOffset, uint64_t(1) << 50);
+    huge = patched<uint64_t>(huge, kNumBlocksOffset, (uint64_t(1) << 50) / 512);
+    assert(deserializeThrows(huge));
+    
+    // The mapped view applies the same checks
+    std::string bad = patched<uint32_t>(shard, kHashFunctionsOffset, 0xFFFFFFFF);
+    std::vector<uint64_t> aligned((bad.size() + 7) / 8);
+    std::memcpy(aligned.data(), bad.data(), bad.size());
+    bool threw = false;
+    try {
+        BloomFilterView view(aligned.data(), bad.size());
+    } catch (const std::runtime_error&) {
+        threw = true;
+    }
+    assert(threw);
+    
+    std::cout << "✓ Bloom Filter deserialize rejects bad shards test passed" << std::endl;
+}
+
+void testBloomFilterMergeIntersect() {
+    BloomFilter a(1000, 0.01);
+    BloomFilter b(1000, 0.01);
+    for (int i = 0; i < 300; i++) a.add("a" + std::to_string(i));
+    for (int i = 0; i < 300; i++) b.add("b" + std::to_string(i));
+    a.add("shared");
+    b.add("shared");
+    
+    BloomFilter both = a;
+    both.intersect(b);
+    assert(both.contains("shared"));
+    
+    a.merge(b);
+    for (int i = 0; i < 300; i++) {
+        assert(a.contains("a" + std::to_string(i)));
+        assert(a.contains("b" + std::to_string(i)));
+    }
+    // Count is re-estimated from the bit population
+    assert(a.getElementCount() > 550 && a.getElementCount() < 650);
+    
+    BloomFilter other(5000, 0.01);
+    bool threw = false;
+    try {
+        a.merge(other);
+    } catch (const std::invalid_argument&) {
+        threw = true;
+    }
+    assert(threw);
+    assert(!a.isCompatible(other.view()));
+    
+    std::cout << "✓ Bloom Filter merge/intersect test passed" << std::endl;
+}
+
+void testBloomFilterMergeAcrossProcesses() {
+    const int nodes = 3;
+    const int perNode = 2000;
+    
+    // Each "ingest node" is a separate process that writes its own shard
+    std::vector<pid_t> children;
+    for (int node = 0; node < nodes; node++) {
+        pid_t pid = ::fork();
+        assert(pid >= 0);
+        if (pid == 0) {
+            BloomFilter shard(nodes * perNode, 0.01, BloomFilter::Layout::Blocked);
+            for (int i = 0; i < perNode; i++) {
+                shard.add(nodeKey(node, i));
+            }
+            std::ofstream out(shardPath(node), std::ios::binary);
+            shard.serialize(out);
+            out.close();
+            ::_exit(out ? 0 : 1);
+        }
+        children.push_back(pid);
+    }
+    for (pid_t pid : children) {
+        int status = 0;
+        ::waitpid(pid, &status, 0);
+        assert(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+    }
+    
+    // Fold the mapped shards into one filter
+    BloomFilterView first = BloomFilterView::open(shardPath(0));
+    assert(first.getElementCount() == perNode);
+    assert(first.contains(nodeKey(0, 42)));
+    
+    BloomFilter combined(first);
+    for (int node = 1; node < nodes; node++) {
+        combined.merge(BloomFilterView::open(shardPath(node)));
+    }
+    
+    for (int node = 0; node < nodes; node++) {
+        for (int i = 0; i < perNode; i++) {
+            assert(combined.contains(nodeKey(node, i)));
+        }
+        std::remove(shardPath(node).c_str());
+    }
+    
+    int falsePositives = 0;
+    for (int i = 0; i < 10000; i++) {
+        falsePositives += combined.contains("unseen" + std::to_string(i));
+    }
+    std::cout << "  Merged " << nodes << " shards, ~" << combined.getElementCount()
+              << " elements, FPR " << falsePositives / 10000.0 << std::endl;
+    assert(falsePositives < 500);
+    
+    std::cout << "✓ Bloom Filter cross-process merge test passed" << std::endl;
+}
+
+int main() {
+    std::cout << "Running Bloom Filter shard tests..." << std::endl;
+    
+    testBloomFilterSerializeRoundTrip();
+    testBloomFilterDeserializeRejectsBadShards();
+    testBloomFilterMergeIntersect();
+    testBloomFilterMergeAcrossProcesses();
+    
+    std::cout << "\n✅ All Bloom Filter shard tests passed!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,90 @@
+#include "kinepredict/data_structures/ConcurrentBloomFilter.h"
+#include <iostream>
+#include <cassert>
+#include <thread>
+#include <vector>
+#include <atomic>
+
+using namespace kinepredict;
+
+void testConcurrentBloomFilterBasic() {
+    ConcurrentBloomFilter bloom(100, 0.01);
+    
+    assert(bloom.add("marketing") == false);
+    bloom.add("content");
+    assert(bloom.add("marketing") == true);
+    
+    assert(bloom.contains("marketing") == true);
+    assert(bloom.contains("content") == true);
+    assert(bloom.contains("nonexistent") == false);
+    assert(bloom.getElementCount() == 3);
+    
+    bloom.clear();
+    assert(bloom.contains("marketing") == false);
+    assert(bloom.getElementCount() == 0);
+    
+    std::cout << "✓ Basic Concurrent Bloom Filter test passed" << std::endl;
+}
+
+void testConcurrentBloomFilterStress() {
+    const int numThreads = 8;
+    const int perThread = 20000;
+    ConcurrentBloomFilter bloom(numThreads * perThread, 0.01);
+    
+    // Writers insert disjoint keys while readers hammer lookups
+    std::atomic<bool> done{false};
+    std::atomic<size_t> readerHits{0};
+    std::vector<std::thread> readers;
+    for (int r = 0; r < 2; r++) {
+        readers.emplace_back([&] {
+            size_t hits = 0;
+            while (!done.load()) {
+                for (int i = 0; i < 1000; i++) {
+                    hits += bloom.contains("t0-" + std::to_string(i));
+                }
+            }
+            readerHits += hits;
+        });
+    }
+    
+    std::vector<std::thread> writers;
+    for (int t = 0; t < numThreads; t++) {
+        writers.emplace_back([&bloom, t] {
+            for (int i = 0; i < perThread; i++) {
+                bloom.add("t" + std::to_string(t) + "-" + std::to_string(i));
+            }
+        });
+    }
+    for (auto& w : writers) w.join();
+    done = true;
+    for (auto& r : readers) r.join();
+    
+    // Every insert is visible after join, and no count was lost
+    for (int t = 0; t < numThreads; t++) {
+        for (int i = 0; i < perThread; i++) {
+            assert(bloom.contains("t" + std::to_string(t) + "-" + std::to_string(i)));
+        }
+    }
+    assert(bloom.getElementCount() == static_cast<size_t>(numThreads * perThread));
+    
+    int falsePositives = 0;
+    const int testCases = 10000;
+    for (int i = 0; i < testCases; i++) {
+        falsePositives += bloom.contains("absent-" + std::to_string(i));
+    }
+    double actualRate = static_cast<double>(falsePositives) / testCases;
+    std::cout << "  False positive rate: " << actualRate << std::endl;
+    assert(actualRate < 0.05);
+    
+    std::cout << "✓ Concurrent Bloom Filter stress test passed" << std::endl;
+}
+
+int main() {
+    std::cout << "Running Concurrent Bloom Filter tests..." << std::endl;
+    
+    testConcurrentBloomFilterBasic();
+    testConcurrentBloomFilterStress();
+    
+    std::cout << "\n✅ All Concurrent Bloom Filter tests passed!" << std::endl;
+    return 0;
+}
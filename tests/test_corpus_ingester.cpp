@@ -0,0 +1,197 @@
+#include "kinepredict/text_processing/CorpusIngester.h"
+#include "kinepredict/text_processing/TextProcessor.h"
+#include <iostream>
+#include <cassert>
+#include <fstream>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <cstdio>
+#include <unistd.h>
+
+using namespace kinepredict;
+
+namespace {
+
+std::string corpusPath() {
+    return "/tmp/kinepredict_corpus_" + std::to_string(::getpid()) + ".txt";
+}
+
+// Headline i of a corpus where every headline appears twice, ten apart
+std::string headline(int i) {
+    int id = i % 10 < 5 ? i : i - 5;
+    return "Flash Sale " + std::to_string(id) + ": Save Big on Item" + std::to_string(id * 7);
+}
+
+} // namespace
+
+void testSplitLines() {
+    std::vector<std::string_view> lines;
+
+    CorpusIngester::splitLines("first\nsecond\r\n\nlast", lines);
+    assert(lines.size() == 4);
+    assert(lines[0] == "first");
+    assert(lines[1] == "second");
+    assert(lines[2].empty());
+    assert(lines[3] == "last");
+
+    CorpusIngester::splitLines("only\n", lines);
+    assert(lines.size() == 1 && lines[0] == "only");
+    CorpusIngester::splitLines("", lines);
+    assert(lines.empty());
+
+    // Long enough to cross several SIMD blocks, newlines at every offset
+    std::string text;
+    std::vector<std::string> expected;
+    for (int i = 0; i < 100; i++) {
+        expected.push_back(std::string(i % 37, 'a' + i % 26));
+        text += expected.back() + "\n";
+    }
+    CorpusIngester::splitLines(text, lines);
+    assert(lines.size() == expected.size());
+    for (size_t i = 0; i < lines.size(); i++) {
+        assert(lines[i] == expected[i]);
+        assert(lines[i].data() >= text.data() && lines[i].data() < text.data() + text.size());
+    }
+
+    std::cout << "✓ Split lines test passed" << std::endl;
+}
+
+void testIngestDedupAndKeywords() {
+    ConcurrentBloomFilter dedup(1000, 0.001);
+    Trie keywords;
+    CorpusIngester ingester(dedup, keywords, 1);
+
+    IngestStats stats = ingester.ingest(
+        "Big SALE today!\n"
+        "big sale today\n"       // Same after normalization
+        "\n"
+        "---\n"                  // Blank after normalization
+        "New arrivals, big savings\r\n"
+        "Big SALE today!");
+
+    assert(stats.lines == 6);
+    assert(stats.uniqueLines == 2);
+    assert(stats.duplicateLines == 2);
+    assert(stats.blankLines == 2);
+    assert(stats.keywords == 7);
+    assert(stats.bytes > 0);
+
+    assert(keywords.size() == 6);
+    assert(keywords.search("sale") == true);
+    assert(keywords.search("arrivals") == true);
+    assert(keywords.search("savings") == true);
+    assert(keywords.search("SALE") == false);
+    assert(dedup.contains("new arrivals big savings") == true);
+
+    // A second run against the same filter sees everything as duplicate
+    stats = ingester.ingest("big sale today\nNEW ARRIVALS big savings\n");
+    assert(stats.uniqueLines == 0);
+    assert(stats.duplicateLines == 2);
+
+    bool threw = false;
+    try { CorpusIngester bad(dedup, keywords, 1, 0); } catch (const std::invalid_argument&) { threw = true; }
+    assert(threw);
+
+    std::cout << "✓ Ingest dedup and keywords test passed" << std::endl;
+}
+
+void testIngestChunkBoundaries() {
+    // Tiny chunks put boundaries inside lines, on newlines and inside
+    // lines longer than a chunk; each line must be seen exactly once
+    std::string corpus;
+    for (int i = 0; i < 400; i++) {
+        corpus += headline(i);
+        if (i % 50 == 0) {
+            corpus += std::string(300, ' ');   // Longer than most chunks, same after normalization
+        }
+        corpus += "\n";
+    }
+
+    for (size_t chunkBytes : {1, 7, 64, 1000, 1 << 20}) {
+        for (size_t threads : {1, 4}) {
+            ConcurrentBloomFilter dedup(1000, 0.0001);
+            Trie keywords;
+            CorpusIngester ingester(dedup, keywords, threads, chunkBytes);
+            IngestStats stats = ingester.ingest(corpus);
+            assert(stats.lines == 400);
+            assert(stats.blankLines == 0);
+            if (threads == 1) {
+                assert(stats.uniqueLines == 200);
+                assert(stats.duplicateLines == 200);
+            } else {
+                // Copies of a line met by two workers at once may both pass
+                assert(stats.uniqueLines >= 200);
+                assert(stats.uniqueLines + stats.duplicateLines == 400);
+            }
+            assert(keywords.search("flash") == true);
+            assert(keywords.search("item1358") == true);    // Headline 194
+            assert(keywords.search("item2765") == false);   // 395 repeats 390
+        }
+    }
+
+    std::cout << "✓ Ingest chunk boundaries test passed" << std::endl;
+}
+
+void testIngestFile() {
+    std::string path = corpusPath();
+    size_t bytes = 0;
+    {
+        std::ofstream out(path, std::ios::binary);
+        for (int i = 0; i < 5000; i++) {
+            std::string line = headline(i) + "\n";
+            out << line;
+            bytes += line.size();
+        }
+    }
+
+    ConcurrentBloomFilter dedup(5000, 0.0001);
+    Trie keywords;
+    CorpusIngester ingester(dedup, keywords, 4, 4096);
+    IngestStats stats = ingester.ingestFile(path);
+
+    assert(stats.bytes == bytes);
+    assert(stats.lines == 5000);
+    assert(stats.uniqueLines >= 2500);
+    assert(stats.uniqueLines + stats.duplicateLines == 5000);
+    assert(stats.keywords == stats.uniqueLines * 7);
+    assert(stats.seconds > 0);
+    assert(stats.megabytesPerSecond() > 0 && stats.linesPerSecond() > 0);
+
+    // Every token of every headline made it into the trie
+    std::set<std::string> expected;
+    std::string buffer;
+    std::vector<std::string_view> tokens;
+    for (int i = 0; i < 5000; i++) {
+        TextProcessor::normalize(headline(i), buffer, tokens);
+        expected.insert(tokens.begin(), tokens.end());
+    }
+    assert(keywords.size() == expected.size());
+
+    std::remove(path.c_str());
+
+    // Empty and missing files
+    { std::ofstream out(path, std::ios::binary); }
+    stats = ingester.ingestFile(path);
+    assert(stats.lines == 0 && stats.bytes == 0);
+    std::remove(path.c_str());
+
+    bool threw = false;
+    try { ingester.ingestFile(path); } catch (const std::runtime_error&) { threw = true; }
+    assert(threw);
+
+    std::cout << "✓ Ingest file test passed" << std::endl;
+}
+
+int main() {
+    std::cout << "Running Corpus Ingester tests..." << std::endl;
+
+    testSplitLines();
+    testIngestDedupAndKeywords();
+    testIngestChunkBoundaries();
+    testIngestFile();
+
+    std::cout << "\n✅ All Corpus Ingester tests passed!" << std::endl;
+    return 0;
+}
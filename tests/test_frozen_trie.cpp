@@ -0,0 +1,118 @@
+#include "kinepredict/data_structures/Trie.h"
+#include "kinepredict/data_structures/FrozenTrie.h"
+#include <iostream>
+#include <cassert>
+#include <algorithm>
+#include <random>
+
+using namespace kinepredict;
+
+void testFrozenTrieBasic() {
+    Trie trie;
+    trie.insert("hello");
+    trie.insert("world");
+    trie.insert("help");
+    
+    FrozenTrie frozen = trie.freeze();
+    
+    assert(frozen.size() == 3);
+    assert(frozen.search("hello") == true);
+    assert(frozen.search("world") == true);
+    assert(frozen.search("help") == true);
+    assert(frozen.search("hell") == false);
+    assert(frozen.search("helicopter") == false);
+    assert(frozen.search("") == false);
+    
+    assert(frozen.startsWith("hel") == true);
+    assert(frozen.startsWith("") == true);
+    assert(frozen.startsWith("banana") == false);
+    
+    std::cout << "✓ Frozen Trie basic test passed" << std::endl;
+}
+
+void testFrozenTrieAutoComplete() {
+    Trie trie;
+    trie.insert("cat");
+    trie.insert("car");
+    trie.insert("card");
+    trie.insert("dog");
+    
+    FrozenTrie frozen = trie.freeze();
+    
+    auto words = frozen.getWordsWithPrefix("ca");
+    assert((words == std::vector<std::string>{"car", "card", "cat"}));
+    assert(frozen.getWordsWithPrefix("card") == std::vector<std::string>{"card"});
+    assert(frozen.getWordsWithPrefix("x").empty());
+    assert(frozen.getWordsWithPrefix("").size() == 4);
+    
+    std::cout << "✓ Frozen Trie autocomplete test passed" << std::endl;
+}
+
+void testFrozenTrieMatchesTrie() {
+    // Random dictionary over a wide alphabet, including non-ASCII bytes
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int> length(1, 12);
+    std::uniform_int_distribution<int> byte(0, 255);
+    std::uniform_int_distribution<int> letter('a', 'f');
+    
+    Trie trie;
+    std::vector<std::string> words;
+    for (int i = 0; i < 5000; i++) {
+        std::string word;
+        int len = length(rng);
+        for (int j = 0; j < len; j++) {
+            word.push_back(static_cast<char>(i % 10 == 0 ? byte(rng) : letter(rng)));
+        }
+        trie.insert(word);
+        words.push_back(word);
+    }
+    
+    FrozenTrie frozen = trie.freeze();
+    assert(frozen.size() == trie.size());
+    
+    for (const auto& word : words) {
+        assert(frozen.search(word));
+        for (size_t cut = 0; cut <= word.size(); cut++) {
+            std::string prefix = word.substr(0, cut);
+            assert(frozen.search(prefix) == trie.search(prefix));
+            assert(frozen.startsWith(prefix) == trie.startsWith(prefix));
+        }
+    }
+    
+    for (const char* prefix : {"", "a", "ab", "fed", "zzz"}) {
+        auto expected = trie.getWordsWithPrefix(prefix);
+        std::sort(expected.begin(), expected.end());
+        assert(frozen.getWordsWithPrefix(prefix) == expected);
+    }
+    
+    std::cout << "  Memory: pointer trie " << trie.getMemoryUsage() / 1024
+              << " KiB, frozen " << frozen.getMemoryUsage() / 1024 << " KiB" << std::endl;
+    assert(frozen.getMemoryUsage() < trie.getMemoryUsage());
+    
+    std::cout << "✓ Frozen Trie matches Trie test passed" << std::endl;
+}
+
+void testFrozenTrieEmpty() {
+    Trie trie;
+    FrozenTrie frozen = trie.freeze();
+    assert(frozen.size() == 0);
+    assert(frozen.search("a") == false);
+    assert(frozen.getWordsWithPrefix("").empty());
+    
+    FrozenTrie defaulted;
+    assert(defaulted.startsWith("a") == false);
+    
+    std::cout << "✓ Frozen Trie empty test passed" << std::endl;
+}
+
+int main() {
+    std::cout << "Running Frozen Trie tests..." << std::endl;
+    
+    testFrozenTrieBasic();
+    testFrozenTrieAutoComplete();
+    testFrozenTrieMatchesTrie();
+    testFrozenTrieEmpty();
+    
+    std::cout << "\n✅ All Frozen Trie tests passed!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,100 @@
+#include "kinepredict/core/Hash.h"
+#include "kinepredict/data_structures/BloomFilter.h"
+#include <iostream>
+#include <cassert>
+#include <cmath>
+#include <string>
+#include <unordered_set>
+
+using namespace kinepredict;
+
+void testHashDeterminism() {
+    std::string text = "Amazing New Product - 50% Off Today!";
+    
+    Hash128 a = hash128(text);
+    Hash128 b = hash128(std::string(text));
+    assert(a.low == b.low && a.high == b.high);
+    assert(a.low != a.high);
+    assert(hash64(text) == a.low);
+    
+    // Seeds give independent families
+    assert(hash128(text, 1).low != a.low);
+    
+    // Every length class (0, 1-3, 4-16, 17-48, >48) is distinct
+    std::unordered_set<uint64_t> seen;
+    for (size_t len = 0; len <= 200; len++) {
+        assert(seen.insert(hash64(std::string(len, 'x'))).second);
+    }
+    
+    std::cout << "✓ Hash determinism test passed" << std::endl;
+}
+
+void testHashAvalanche() {
+    // Flipping any input bit should flip ~half of the output bits of both halves
+    const int lengths[] = {3, 8, 15, 33, 64, 100};
+    for (int len : lengths) {
+        std::string key(len, '\0');
+        for (int i = 0; i < len; i++) key[i] = static_cast<char>('a' + (i * 7) % 26);
+        Hash128 base = hash128(key);
+        
+        double totalFlips = 0;
+        int trials = 0;
+        for (int byte = 0; byte < len; byte++) {
+            for (int bit = 0; bit < 8; bit++) {
+                std::string flipped = key;
+                flipped[byte] ^= static_cast<char>(1 << bit);
+                Hash128 h = hash128(flipped);
+                totalFlips += __builtin_popcountll(h.low ^ base.low);
+                totalFlips += __builtin_popcountll(h.high ^ base.high);
+                trials += 2;
+            }
+        }
+        double average = totalFlips / trials;
+        assert(std::abs(average - 32.0) < 2.0);
+    }
+    
+    std::cout << "✓ Hash avalanche test passed" << std::endl;
+}
+
+void testHashCombine() {
+    uint64_t ab = hashCombine(hash64("buy"), hash64("now"));
+    uint64_t ba = hashCombine(hash64("now"), hash64("buy"));
+    assert(ab != ba);  // Order sensitive
+    assert(hashMix(1) != hashMix(2));
+    
+    std::cout << "✓ Hash combine test passed" << std::endl;
+}
+
+void testHashBloomFilterQuality() {
+    // Sequential keys are the worst case for weak hashes; the measured rate
+    // should track the theoretical one
+    const int inserted = 20000;
+    const int testCases = 200000;
+    BloomFilter bloom(inserted, 0.01);
+    for (int i = 0; i < inserted; i++) {
+        bloom.add("item" + std::to_string(i));
+    }
+    
+    int falsePositives = 0;
+    for (int i = inserted; i < inserted + testCases; i++) {
+        falsePositives += bloom.contains("item" + std::to_string(i));
+    }
+    double measured = static_cast<double>(falsePositives) / testCases;
+    double theoretical = bloom.getFalsePositiveRate();
+    std::cout << "  FPR measured " << measured << ", theoretical " << theoretical << std::endl;
+    assert(measured < theoretical * 1.3);
+    
+    std::cout << "✓ Hash Bloom Filter quality test passed" << std::endl;
+}
+
+int main() {
+    std::cout << "Running Hash tests..." << std::endl;
+    
+    testHashDeterminism();
+    testHashAvalanche();
+    testHashCombine();
+    testHashBloomFilterQuality();
+    
+    std::cout << "\n✅ All Hash tests passed!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,190 @@
+#include "kinepredict/data_structures/LRUCache.h"
+#include <iostream>
+#include <cassert>
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace kinepredict;
+
+namespace {
+
+// Manually advanced clock for deterministic TTL tests
+struct FakeClock {
+    using duration = std::chrono::milliseconds;
+    using rep = duration::rep;
+    using period = duration::period;
+    using time_point = std::chrono::time_point<FakeClock>;
+    static constexpr bool is_steady = true;
+
+    static time_point now() { return current; }
+    static inline time_point current{};
+};
+
+// Fixed 100-byte charge per entry, whatever the value
+struct FlatCharge {
+    size_t operator()(int) const { return 100 - LRUCache<int>::kEntryOverhead; }
+};
+
+} // namespace
+
+void testLRUCacheBasic() {
+    LRUCache<double> cache(1 << 20);
+    assert(cache.get(1).has_value() == false);
+
+    assert(cache.put(1, 0.75) == true);
+    assert(cache.put(2, 0.5) == true);
+    assert(cache.get(1).value() == 0.75);
+    assert(cache.get(2).value() == 0.5);
+
+    cache.put(1, 0.9);                      // Replace
+    assert(cache.get(1).value() == 0.9);
+
+    assert(cache.erase(2) == true);
+    assert(cache.erase(2) == false);
+    assert(cache.get(2).has_value() == false);
+
+    auto stats = cache.stats();
+    assert(stats.hits == 3);
+    assert(stats.misses == 2);
+    assert(stats.entries == 1);
+    assert(stats.bytes == sizeof(double) + LRUCache<double>::kEntryOverhead);
+
+    cache.clear();
+    assert(cache.stats().entries == 0 && cache.stats().bytes == 0);
+    assert(cache.get(1).has_value() == false);
+
+    bool threw = false;
+    try { LRUCache<double> bad(0); } catch (const std::invalid_argument&) { threw = true; }
+    assert(threw);
+
+    std::cout << "✓ LRU Cache basic test passed" << std::endl;
+}
+
+void testLRUCacheEvictionOrder() {
+    // One shard, room for exactly three 100-byte entries
+    LRUCache<int, FlatCharge> cache(300, std::chrono::steady_clock::duration::zero(), 1);
+    assert(cache.numShards() == 1);
+    cache.put(1, 1);
+    cache.put(2, 2);
+    cache.put(3, 3);
+    assert(cache.get(1).has_value());       // 2 is now least recently used
+
+    cache.put(4, 4);
+    assert(cache.get(2).has_value() == false);
+    assert(cache.get(1).has_value() && cache.get(3).has_value() && cache.get(4).has_value());
+
+    auto stats = cache.stats();
+    assert(stats.evictions == 1);
+    assert(stats.entries == 3);
+    assert(stats.bytes == 300);
+
+    std::cout << "✓ LRU Cache eviction order test passed" << std::endl;
+}
+
+void testLRUCacheByteBudget() {
+    // Strings are charged by capacity, so a few large values push out many small ones
+    LRUCache<std::string> cache(64 * 1024, std::chrono::steady_clock::duration::zero(), 4);
+    for (uint64_t i = 0; i < 1000; i++) {
+        cache.put(hashMix(i), std::string(100, 'x'));
+    }
+    auto stats = cache.stats();
+    assert(stats.bytes <= cache.byteBudget());
+    assert(stats.evictions > 0);
+    assert(stats.entries + stats.evictions == 1000);
+
+    // Larger than a shard's slice of the budget: rejected, and replaces nothing
+    cache.put(42, "small");
+    assert(cache.put(42, std::string(32 * 1024, 'y')) == false);
+    assert(cache.get(42).has_value() == false);
+
+    std::cout << "✓ LRU Cache byte budget test passed" << std::endl;
+}
+
+void testLRUCacheTtl() {
+    using Cache = LRUCache<int, CacheCharge<int>, FakeClock>;
+    Cache cache(1 << 20, std::chrono::milliseconds(100));
+
+    cache.put(1, 10);                                      // Default TTL
+    cache.put(2, 20, std::chrono::milliseconds(500));
+    cache.put(3, 30, FakeClock::duration::zero());         // Never expires
+
+    FakeClock::current += std::chrono::milliseconds(99);
+    assert(cache.get(1).value() == 10);
+
+    FakeClock::current += std::chrono::milliseconds(1);
+    assert(cache.get(1).has_value() == false);
+    assert(cache.get(2).value() == 20);
+
+    FakeClock::current += std::chrono::hours(1);
+    assert(cache.get(2).has_value() == false);
+    assert(cache.get(3).value() == 30);
+
+    auto stats = cache.stats();
+    assert(stats.expirations == 2);
+    assert(stats.entries == 1);
+
+    // Re-putting refreshes the TTL
+    cache.put(1, 11);
+    FakeClock::current += std::chrono::milliseconds(50);
+    cache.put(1, 12);
+    FakeClock::current += std::chrono::milliseconds(60);
+    assert(cache.get(1).value() == 12);
+
+    // TTLs that would overflow the clock never expire
+    cache.put(4, 40, FakeClock::duration::max());
+    cache.put(5, 50, FakeClock::duration::max() - std::chrono::milliseconds(1));
+    Cache forever(1 << 20, FakeClock::duration::max());
+    forever.put(1, 10);
+    FakeClock::current += std::chrono::hours(24 * 365 * 1000);
+    assert(cache.get(4).value() == 40);
+    assert(cache.get(5).value() == 50);
+    assert(forever.get(1).value() == 10);
+
+    std::cout << "✓ LRU Cache TTL test passed" << std::endl;
+}
+
+void testLRUCacheConcurrent() {
+    LRUCache<uint64_t> cache(256 * 1024);
+    std::atomic<size_t> wrongValues{0};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 8; t++) {
+        threads.emplace_back([&, t] {
+            for (uint64_t i = 0; i < 20000; i++) {
+                uint64_t key = (i * 31 + t) % 5000;
+                auto value = cache.get(key);
+                if (value) {
+                    wrongValues += *value != key * 3;
+                } else {
+                    cache.put(key, key * 3);
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    auto stats = cache.stats();
+    assert(wrongValues.load() == 0);
+    assert(stats.hits + stats.misses == 8 * 20000);
+    assert(stats.bytes <= cache.byteBudget());
+    assert(stats.hits > 0);
+
+    std::cout << "✓ LRU Cache concurrent test passed" << std::endl;
+}
+
+int main() {
+    std::cout << "Running LRU Cache tests..." << std::endl;
+
+    testLRUCacheBasic();
+    testLRUCacheEvictionOrder();
+    testLRUCacheByteBudget();
+    testLRUCacheTtl();
+    testLRUCacheConcurrent();
+
+    std::cout << "\n✅ All LRU Cache tests passed!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,184 @@
+#include "kinepredict/text_processing/MinHash.h"
+#include "kinepredict/data_structures/LshIndex.h"
+#include <iostream>
+#include <cassert>
+#include <cmath>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace kinepredict;
+
+void testMinHashBasic() {
+    MinHash minHash(128);
+    assert(minHash.numHashes() == 128);
+
+    auto a = minHash.signature("50% Off Today!");
+    auto b = minHash.signature("50% off today");
+    auto c = minHash.signature("Free shipping on all orders");
+    assert(a.size() == 128);
+    assert(a == b);                                  // Same after normalization
+    assert(MinHash::similarity(a, b) == 1.0);
+    assert(MinHash::similarity(a, c) < 0.2);
+
+    // Same parameters give the same signature; another seed does not
+    assert(MinHash(128).signature("50% off today") == a);
+    assert(MinHash(128, 2, 7).signature("50% off today") != a);
+
+    // No tokens: every slot stays at the maximum
+    for (uint32_t slot : minHash.signature("!!!")) {
+        assert(slot == UINT32_MAX);
+    }
+
+    std::vector<uint64_t> shingles;
+    minHash.shingles("big summer sale, big summer", shingles);
+    assert(shingles.size() == 6);                    // 3 words + 3 distinct bigrams
+    for (size_t i = 1; i < shingles.size(); i++) {
+        assert(shingles[i - 1] < shingles[i]);
+    }
+
+    bool threw = false;
+    try { MinHash bad(0); } catch (const std::invalid_argument&) { threw = true; }
+    assert(threw);
+    threw = false;
+    try { MinHash::similarity(a, std::vector<uint32_t>(64)); } catch (const std::invalid_argument&) { threw = true; }
+    assert(threw);
+
+    std::cout << "✓ MinHash basic test passed" << std::endl;
+}
+
+void testMinHashEstimatesJaccard() {
+    // Shingle sets with known overlap: the estimate should track the
+    // exact Jaccard within a few standard errors (1/sqrt(256) ~ 0.06)
+    MinHash minHash(256);
+    std::mt19937_64 rng(42);
+    std::vector<uint32_t> sigA;
+    std::vector<uint32_t> sigB;
+    double totalError = 0.0;
+    for (int trial = 0; trial < 50; trial++) {
+        size_t shared = 20 + rng() % 100;
+        size_t onlyA = rng() % 100;
+        size_t onlyB = rng() % 100;
+        std::vector<uint64_t> a;
+        std::vector<uint64_t> b;
+        for (size_t i = 0; i < shared; i++) { uint64_t x = rng(); a.push_back(x); b.push_back(x); }
+        for (size_t i = 0; i < onlyA; i++) a.push_back(rng());
+        for (size_t i = 0; i < onlyB; i++) b.push_back(rng());
+
+        minHash.signature(a, sigA);
+        minHash.signature(b, sigB);
+        double exact = static_cast<double>(shared) / (shared + onlyA + onlyB);
+        double error = std::abs(MinHash::similarity(sigA, sigB) - exact);
+        assert(error < 0.15);
+        totalError += error;
+    }
+    assert(totalError / 50 < 0.05);
+
+    std::vector<uint64_t> x = {1, 2, 3, 4};
+    std::vector<uint64_t> y = {3, 4, 5};
+    assert(std::abs(MinHash::jaccard(x, y) - 0.4) < 1e-12);
+    assert(MinHash::jaccard({}, {}) == 1.0);
+
+    std::cout << "✓ MinHash Jaccard estimate test passed" << std::endl;
+}
+
+void testLshIndexBanding() {
+    LshIndex index(128, 0.8);
+    assert(index.numBands() * index.rowsPerBand() <= 128);
+    assert(index.numBands() > 1 && index.rowsPerBand() > 1);
+
+    // The S-curve is steep around the threshold
+    assert(index.candidateProbability(0.95) > 0.99);
+    assert(index.candidateProbability(0.4) < 0.05);
+
+    // Lower thresholds use more, shorter bands
+    LshIndex loose(128, 0.5);
+    assert(loose.numBands() > index.numBands());
+    assert(loose.rowsPerBand() < index.rowsPerBand());
+
+    bool threw = false;
+    try { LshIndex bad(128, 0.0); } catch (const std::invalid_argument&) { threw = true; }
+    assert(threw);
+    threw = false;
+    try { index.insert(std::vector<uint32_t>(64)); } catch (const std::invalid_argument&) { threw = true; }
+    assert(threw);
+
+    std::cout << "✓ LSH index banding test passed" << std::endl;
+}
+
+void testLshIndexNearDuplicates() {
+    MinHash minHash(128);
+    LshIndex index(minHash.numHashes(), 0.5);
+
+    std::vector<std::string> headlines = {
+        "50% Off Today Only On All Summer Dresses",           // 0
+        "Free Shipping On Orders Over $50 This Weekend",      // 1
+        "New Arrivals: Fall Boots And Leather Jackets",       // 2
+        "10 Marketing Tips You Won't Believe Work",           // 3
+        "50% off today only on all summer dresses!!!",        // 4: exact variant of 0
+    };
+    for (const auto& headline : headlines) {
+        index.insert(minHash.signature(headline));
+    }
+    assert(index.size() == 5);
+
+    auto matches = index.query(minHash.signature("50% OFF today only on all summer dresses"));
+    assert(matches.size() == 2);
+    assert(matches[0].id == 0 && matches[1].id == 4);
+    assert(matches[0].similarity == 1.0);
+
+    // One word changed out of eight: still a near-duplicate
+    matches = index.query(minHash.signature("Free Shipping On Orders Over $75 This Weekend"));
+    assert(!matches.empty() && matches[0].id == 1);
+    assert(matches[0].similarity >= 0.5 && matches[0].similarity < 1.0);
+
+    // Unrelated text has no matches
+    assert(index.query(minHash.signature("Quarterly earnings call transcript")).empty());
+
+    std::vector<LshIndex::Id> candidates;
+    index.candidates(minHash.signature("new arrivals fall boots and leather jackets"), candidates);
+    assert(candidates.size() == 1 && candidates[0] == 2);
+
+    std::cout << "✓ LSH index near-duplicates test passed" << std::endl;
+}
+
+void testLshIndexSkipsEmptySignatures() {
+    MinHash minHash(128);
+    LshIndex index(minHash.numHashes(), 0.5);
+
+    index.insert(minHash.signature("Summer sale on all dresses"));
+    const char* blanks[] = {"", "   ", "!!!", "-- ? --", "\u2014"};
+    for (int i = 0; i < 2000; i++) {
+        std::vector<uint32_t> signature = minHash.signature(blanks[i % 5]);
+        assert(LshIndex::isEmpty(signature));
+        LshIndex::Id id = index.insert(signature);
+        assert(id == static_cast<LshIndex::Id>(i + 1));   // Ids stay dense
+    }
+    assert(index.size() == 2001);
+    assert(!LshIndex::isEmpty(minHash.signature("sale")));
+
+    // Blank items are not near-duplicates of each other or of anything else
+    std::vector<LshIndex::Id> candidates;
+    index.candidates(minHash.signature("?!"), candidates);
+    assert(candidates.empty());
+    assert(index.query(minHash.signature("")).empty());
+
+    index.candidates(minHash.signature("summer sale on all dresses!"), candidates);
+    assert(candidates.size() == 1 && candidates[0] == 0);
+
+    std::cout << "✓ LSH index skips empty signatures test passed" << std::endl;
+}
+
+int main() {
+    std::cout << "Running MinHash tests..." << std::endl;
+
+    testMinHashBasic();
+    testMinHashEstimatesJaccard();
+    testLshIndexBanding();
+    testLshIndexNearDuplicates();
+    testLshIndexSkipsEmptySignatures();
+
+    std::cout << "\n✅ All MinHash tests passed!" << std::endl;
+    return 0;
+}
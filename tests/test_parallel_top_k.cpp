@@ -0,0 +1,122 @@
+#include "kinepredict/data_structures/ParallelTopK.h"
+#include <iostream>
+#include <cassert>
+#include <algorithm>
+#include <random>
+#include <stdexcept>
+#include <string>
+
+using namespace kinepredict;
+
+struct Variant {
+    size_t id;
+    double score;
+    
+    bool operator>(const Variant& other) const {
+        return score > other.score || (score == other.score && id < other.id);
+    }
+};
+
+std::vector<double> makeScores(size_t count, unsigned seed) {
+    std::mt19937 rng(seed);
+    std::vector<double> scores(count);
+    for (auto& score : scores) score = static_cast<double>(rng() % 100000) / 100000.0;  // With ties
+    return scores;
+}
+
+void testParallelTopKMatchesSort() {
+    auto scores = makeScores(100000, 3);
+    std::vector<Variant> expected;
+    for (size_t i = 0; i < scores.size(); i++) expected.push_back({i, scores[i]});
+    std::sort(expected.begin(), expected.end(), std::greater<Variant>());
+    
+    for (size_t threads : {1, 2, 3, 8}) {
+        ParallelTopK<Variant, std::greater<Variant>> ranker(50, threads);
+        auto top = ranker.run(scores.size(), [&](size_t i) { return Variant{i, scores[i]}; });
+        assert(top.size() == 50);
+        for (size_t i = 0; i < top.size(); i++) {
+            assert(top[i].id == expected[i].id);
+        }
+    }
+    
+    std::cout << "✓ Parallel TopK matches sort test passed" << std::endl;
+}
+
+void testParallelTopKFullOrder() {
+    auto scores = makeScores(5000, 4);
+    ParallelTopK<Variant, std::greater<Variant>> ranker(scores.size(), 4);
+    auto ranked = ranker.run(scores.size(), [&](size_t i) { return Variant{i, scores[i]}; });
+    
+    assert(ranked.size() == scores.size());
+    assert(std::is_sorted(ranked.begin(), ranked.end(), std::greater<Variant>()));
+    
+    // Fewer items than threads or k, and no items at all
+    ParallelTopK<int> smallest(10, 8);
+    auto few = smallest.run(3, [](size_t i) { return static_cast<int>(10 - i); });
+    assert((few == std::vector<int>{8, 9, 10}));
+    assert(smallest.run(0, [](size_t i) { return static_cast<int>(i); }).empty());
+    
+    std::cout << "✓ Parallel TopK full order test passed" << std::endl;
+}
+
+void testKWayMerge() {
+    std::vector<std::vector<std::string>> runs = {
+        {"apple", "melon", "zebra"},
+        {},
+        {"banana", "cherry"},
+        {"aardvark"}
+    };
+    auto merged = ParallelTopK<std::string>::merge(runs, 10);
+    assert((merged == std::vector<std::string>{"aardvark", "apple", "banana", "cherry", "melon", "zebra"}));
+    
+    auto firstThree = ParallelTopK<std::string>::merge(runs, 3);
+    assert((firstThree == std::vector<std::string>{"aardvark", "apple", "banana"}));
+    
+    bool threw = false;
+    try {
+        ParallelTopK<int> none(0, 4);
+    } catch (const std::invalid_argument&) {
+        threw = true;
+    }
+    assert(threw);
+    
+    std::cout << "✓ K-way merge test passed" << std::endl;
+}
+
+void testParallelTopKProducerThrows() {
+    // Throwing on a worker range and on the caller's own range (item 0)
+    for (size_t failing : {size_t(0), size_t(7777)}) {
+        for (size_t threads : {1, 4}) {
+            ParallelTopK<Variant, std::greater<Variant>> ranker(10, threads);
+            bool threw = false;
+            try {
+                ranker.run(10000, [&](size_t i) {
+                    if (i == failing) throw std::runtime_error("scoring failed");
+                    return Variant{i, static_cast<double>(i)};
+                });
+            } catch (const std::runtime_error& error) {
+                threw = std::string(error.what()) == "scoring failed";
+            }
+            assert(threw);
+        }
+    }
+    
+    // Still usable afterwards
+    ParallelTopK<Variant, std::greater<Variant>> ranker(3, 4);
+    auto top = ranker.run(100, [](size_t i) { return Variant{i, static_cast<double>(i)}; });
+    assert(top.size() == 3 && top[0].id == 99);
+    
+    std::cout << "✓ Parallel TopK producer throws test passed" << std::endl;
+}
+
+int main() {
+    std::cout << "Running Parallel TopK tests..." << std::endl;
+    
+    testParallelTopKMatchesSort();
+    testParallelTopKFullOrder();
+    testKWayMerge();
+    testParallelTopKProducerThrows();
+    
+    std::cout << "\n✅ All Parallel TopK tests passed!" << std::endl;
+    return 0;
+}
@@ -1,6 +1,15 @@
 #include "kinepredict/data_structures/PriorityQueue.h"
+#include "kinepredict/data_structures/KeyedPriorityQueue.h"
+#include "kinepredict/data_structures/TopK.h"
+#include "kinepredict/data_structures/IndexedPriorityQueue.h"
 #include <iostream>
 #include <cassert>
+#include <algorithm>
+#include <random>
+#include <set>
+#include <map>
+#include <cstdlib>
+#include <string>
 
 using namespace kinepredict;
 
@@ -70,12 +79,308 @@ void testPriorityQueueCustomType() {
     std::cout << "✓ Custom type Priority Queue test passed" << std::endl;
 }
 
+template<size_t Arity>
+void checkArityAgainstMultiset() {
+    std::mt19937 rng(Arity);
+    PriorityQueue<int, std::less<int>, Arity> pq;
+    std::multiset<int> reference;
+    
+    // Interleaved pushes and pops with plenty of duplicates
+    for (int i = 0; i < 20000; i++) {
+        if (reference.empty() || rng() % 3 != 0) {
+            int value = static_cast<int>(rng() % 1000);
+            pq.push(value);
+            reference.insert(value);
+        } else {
+            assert(pq.top() == *reference.begin());
+            assert(pq.pop() == *reference.begin());
+            reference.erase(reference.begin());
+        }
+        assert(pq.size() == reference.size());
+    }
+}
+
+void testPriorityQueueArity() {
+    checkArityAgainstMultiset<2>();
+    checkArityAgainstMultiset<3>();
+    checkArityAgainstMultiset<4>();
+    checkArityAgainstMultiset<8>();
+    
+    // Full drain order matches a sort for every arity
+    std::mt19937 rng(99);
+    std::vector<double> scores(10000);
+    for (auto& score : scores) score = static_cast<double>(rng()) / rng.max();
+    
+    PriorityQueue<double, std::greater<double>, 8> pq;
+    for (double score : scores) pq.push(score);
+    std::sort(scores.rbegin(), scores.rend());
+    for (double expected : scores) {
+        assert(pq.pop() == expected);
+    }
+    
+    std::cout << "✓ d-ary Priority Queue test passed" << std::endl;
+}
+
+void testPriorityQueueComparatorInstance() {
+    // Stateful comparator: rank by distance from a pivot
+    struct CloserTo {
+        int pivot;
+        bool operator()(int a, int b) const { return std::abs(a - pivot) < std::abs(b - pivot); }
+    };
+    
+    PriorityQueue<int, CloserTo> pq(CloserTo{50});
+    for (int value : {10, 90, 48, 55, 70}) pq.push(value);
+    assert(pq.pop() == 48);
+    assert(pq.pop() == 55);
+    assert(pq.pop() == 70);
+    
+    std::cout << "✓ Comparator instance Priority Queue test passed" << std::endl;
+}
+
+void testKeyedPriorityQueue() {
+    KeyedPriorityQueue<double, std::string, std::greater<double>> pq;
+    
+    pq.push(0.85, "Buy Now - 50% Off!");
+    pq.push(0.92, "Limited Time Offer");
+    pq.push(0.67, "Check This Out");
+    
+    assert(pq.size() == 3);
+    assert(pq.topKey() == 0.92);
+    assert(pq.topValue() == "Limited Time Offer");
+    
+    auto [score, headline] = pq.pop();
+    assert(score == 0.92 && headline == "Limited Time Offer");
+    assert(pq.pop().second == "Buy Now - 50% Off!");
+    assert(pq.pop().second == "Check This Out");
+    assert(pq.empty());
+    
+    bool threw = false;
+    try {
+        pq.pop();
+    } catch (const std::runtime_error&) {
+        threw = true;
+    }
+    assert(threw);
+    
+    // Payloads stay attached to their keys through many sifts
+    std::mt19937 rng(5);
+    KeyedPriorityQueue<uint32_t, std::string, std::less<uint32_t>, 8> large;
+    for (int i = 0; i < 5000; i++) {
+        uint32_t key = rng() % 100000;
+        large.push(key, std::to_string(key));
+    }
+    uint32_t previous = 0;
+    while (!large.empty()) {
+        auto [key, value] = large.pop();
+        assert(key >= previous);
+        assert(value == std::to_string(key));
+        previous = key;
+    }
+    
+    std::cout << "✓ Keyed Priority Queue test passed" << std::endl;
+}
+
+void testPriorityQueueBulkBuild() {
+    std::mt19937 rng(21);
+    std::vector<int> values(10000);
+    for (auto& value : values) value = static_cast<int>(rng() % 5000);
+    std::vector<int> expected = values;
+    std::sort(expected.begin(), expected.end());
+    
+    // Heapify in place from a moved-in vector
+    std::vector<int> copy = values;
+    PriorityQueue<int> pq(std::move(copy));
+    assert(pq.size() == values.size());
+    assert(pq.top() == expected.front());
+    for (size_t i = 0; i < 100; i++) {
+        assert(pq.pop() == expected[i]);
+    }
+    
+    pq.assign({3, 1, 2});
+    assert(pq.size() == 3);
+    assert(pq.pop() == 1);
+    
+    PriorityQueue<int, std::greater<int>, 8> maxHeap(values);
+    std::vector<int> drained = maxHeap.drainSorted();
+    assert(maxHeap.empty());
+    assert(std::equal(drained.begin(), drained.end(), expected.rbegin()));
+    
+    PriorityQueue<int> empty(std::vector<int>{});
+    assert(empty.drainSorted().empty());
+    
+    std::cout << "✓ Bulk build and drainSorted Priority Queue test passed" << std::endl;
+}
+
+void testPriorityQueueReplaceTop() {
+    PriorityQueue<int> pq(std::vector<int>{4, 8, 6});
+    assert(pq.replaceTop(7) == 4);
+    assert(pq.top() == 6);
+    assert(pq.replaceTop(1) == 6);
+    assert(pq.pop() == 1);
+    assert(pq.pop() == 7);
+    assert(pq.pop() == 8);
+    
+    bool threw = false;
+    try {
+        pq.replaceTop(3);
+    } catch (const std::runtime_error&) {
+        threw = true;
+    }
+    assert(threw);
+    
+    std::cout << "✓ replaceTop Priority Queue test passed" << std::endl;
+}
+
+void testTopK() {
+    // Highest scores win: std::greater ranks larger first, as in PriorityQueue
+    TopK<double, std::greater<double>> best(3);
+    assert(best.empty() && best.capacity() == 3);
+    
+    for (double score : {0.5, 0.9, 0.1, 0.7, 0.3, 0.95, 0.2}) {
+        best.offer(score);
+    }
+    assert(best.full());
+    assert(best.worst() == 0.7);
+    assert(best.offer(0.6) == false);  // Rejected against worst()
+    assert(best.offer(0.8) == true);
+    
+    auto top = best.drainSorted();
+    assert((top == std::vector<double>{0.95, 0.9, 0.8}));
+    assert(best.empty());
+    
+    // Large stream against a full sort, custom records
+    std::mt19937 rng(8);
+    std::vector<Prediction> stream;
+    for (int i = 0; i < 20000; i++) {
+        stream.push_back({"headline " + std::to_string(i), static_cast<double>(rng()) / rng.max()});
+    }
+    TopK<Prediction, std::greater<Prediction>> collector(100);
+    for (const auto& prediction : stream) collector.offer(prediction);
+    
+    std::sort(stream.begin(), stream.end(), std::greater<Prediction>());
+    auto ranked = collector.drainSorted();
+    assert(ranked.size() == 100);
+    for (size_t i = 0; i < ranked.size(); i++) {
+        assert(ranked[i].headline == stream[i].headline);
+    }
+    
+    bool threw = false;
+    try {
+        TopK<int> none(0);
+    } catch (const std::invalid_argument&) {
+        threw = true;
+    }
+    assert(threw);
+    
+    std::cout << "✓ TopK test passed" << std::endl;
+}
+
+void testIndexedPriorityQueue() {
+    // Highest CTR first
+    IndexedPriorityQueue<double, std::greater<double>> ranking;
+    ranking.push(7, 0.10);
+    ranking.push(3, 0.25);
+    ranking.push(12, 0.05);
+    
+    assert(ranking.size() == 3);
+    assert(ranking.topHandle() == 3);
+    assert(ranking.contains(12) && !ranking.contains(4) && !ranking.contains(1000));
+    
+    ranking.update(12, 0.40);  // Promoted
+    assert(ranking.topHandle() == 12);
+    ranking.update(12, 0.01);  // Demoted
+    assert(ranking.topHandle() == 3);
+    assert(ranking.priority(12) == 0.01);
+    
+    ranking.erase(3);
+    assert(!ranking.contains(3));
+    assert(ranking.topHandle() == 7);
+    
+    auto [handle, ctr] = ranking.pop();
+    assert(handle == 7 && ctr == 0.10);
+    assert(ranking.pop().first == 12);
+    assert(ranking.empty());
+    
+    // Handles can be reused once removed; misuse throws
+    ranking.push(3, 0.5);
+    bool threw = false;
+    try { ranking.push(3, 0.6); } catch (const std::invalid_argument&) { threw = true; }
+    assert(threw);
+    threw = false;
+    try { ranking.update(99, 0.6); } catch (const std::invalid_argument&) { threw = true; }
+    assert(threw);
+    threw = false;
+    try { ranking.erase(7); } catch (const std::invalid_argument&) { threw = true; }
+    assert(threw);
+    
+    std::cout << "✓ Indexed Priority Queue test passed" << std::endl;
+}
+
+void testIndexedPriorityQueueRandomOps() {
+    std::mt19937 rng(17);
+    IndexedPriorityQueue<int> pq;
+    std::map<uint32_t, int> live;   // Reference: handle -> priority
+    
+    auto referenceTop = [&] {
+        auto best = live.begin();
+        for (auto it = live.begin(); it != live.end(); ++it) {
+            if (it->second < best->second) best = it;
+        }
+        return best->second;
+    };
+    
+    for (int step = 0; step < 20000; step++) {
+        uint32_t handle = rng() % 500;
+        int priority = static_cast<int>(rng() % 10000);
+        switch (rng() % 4) {
+            case 0:
+                if (!pq.contains(handle)) {
+                    pq.push(handle, priority);
+                    live[handle] = priority;
+                }
+                break;
+            case 1:
+                if (pq.contains(handle)) {
+                    pq.update(handle, priority);
+                    live[handle] = priority;
+                }
+                break;
+            case 2:
+                if (pq.contains(handle)) {
+                    pq.erase(handle);
+                    live.erase(handle);
+                }
+                break;
+            default:
+                if (!pq.empty()) {
+                    int expected = referenceTop();
+                    auto [top, value] = pq.pop();
+                    assert(value == expected);
+                    assert(live.at(top) == value);
+                    live.erase(top);
+                }
+        }
+        assert(pq.size() == live.size());
+        assert(pq.contains(handle) == (live.count(handle) == 1));
+    }
+    
+    std::cout << "✓ Indexed Priority Queue random operations test passed" << std::endl;
+}
+
 int main() {
     std::cout << "Running Priority Queue tests..." << std::endl;
     
     testPriorityQueueMinHeap();
     testPriorityQueueMaxHeap();
     testPriorityQueueCustomType();
+    testPriorityQueueArity();
+    testPriorityQueueComparatorInstance();
+    testKeyedPriorityQueue();
+    testPriorityQueueBulkBuild();
+    testPriorityQueueReplaceTop();
+    testTopK();
+    testIndexedPriorityQueue();
+    testIndexedPriorityQueueRandomOps();
     
     std::cout << "\n✅ All Priority Queue tests passed!" << std::endl;
     return 0;
@@ -0,0 +1,87 @@
+#include "kinepredict/data_structures/ScalableBloomFilter.h"
+#include <iostream>
+#include <cassert>
+
+using namespace kinepredict;
+
+void testScalableBloomFilterBasic() {
+    ScalableBloomFilter bloom(100, 0.01);
+    
+    bloom.add("marketing");
+    bloom.add("content");
+    
+    assert(bloom.contains("marketing") == true);
+    assert(bloom.contains("content") == true);
+    assert(bloom.contains("nonexistent") == false);
+    assert(bloom.getFilterCount() == 1);
+    assert(bloom.getElementCount() == 2);
+    
+    std::cout << "✓ Basic Scalable Bloom Filter test passed" << std::endl;
+}
+
+void testScalableBloomFilterGrowth() {
+    // Overshoot the estimate 50x
+    ScalableBloomFilter bloom(1000, 0.01);
+    const int inserted = 50000;
+    
+    for (int i = 0; i < inserted; i++) {
+        bloom.add("item" + std::to_string(i));
+    }
+    
+    assert(bloom.getFilterCount() > 1);
+    assert(bloom.getElementCount() == static_cast<size_t>(inserted));
+    
+    // No false negatives across sub-filters
+    for (int i = 0; i < inserted; i++) {
+        assert(bloom.contains("item" + std::to_string(i)));
+    }
+    
+    int falsePositives = 0;
+    const int testCases = 20000;
+    for (int i = inserted; i < inserted + testCases; i++) {
+        falsePositives += bloom.contains("item" + std::to_string(i));
+    }
+    
+    double actualRate = static_cast<double>(falsePositives) / testCases;
+    std::cout << "  " << bloom.getFilterCount() << " sub-filters, FPR measured "
+              << actualRate << ", compound " << bloom.getFalsePositiveRate() << std::endl;
+    
+    assert(bloom.getFalsePositiveRate() <= 0.01);
+    assert(actualRate < 0.03);
+    
+    // A fixed filter with the same estimate degrades badly
+    BloomFilter fixed(1000, 0.01);
+    for (int i = 0; i < inserted; i++) {
+        fixed.add("item" + std::to_string(i));
+    }
+    assert(fixed.getFalsePositiveRate() > 0.5);
+    
+    std::cout << "✓ Scalable Bloom Filter growth test passed" << std::endl;
+}
+
+void testScalableBloomFilterClear() {
+    ScalableBloomFilter bloom(10, 0.01, BloomFilter::Layout::Blocked);
+    for (int i = 0; i < 1000; i++) {
+        bloom.add("item" + std::to_string(i));
+    }
+    size_t grownMemory = bloom.getMemoryUsage();
+    
+    bloom.clear();
+    assert(bloom.getFilterCount() == 1);
+    assert(bloom.getElementCount() == 0);
+    assert(bloom.getMemoryUsage() < grownMemory);
+    assert(bloom.contains("item1") == false);
+    
+    std::cout << "✓ Scalable Bloom Filter clear test passed" << std::endl;
+}
+
+int main() {
+    std::cout << "Running Scalable Bloom Filter tests..." << std::endl;
+    
+    testScalableBloomFilterBasic();
+    testScalableBloomFilterGrowth();
+    testScalableBloomFilterClear();
+    
+    std::cout << "\n✅ All Scalable Bloom Filter tests passed!" << std::endl;
+    return 0;
+}
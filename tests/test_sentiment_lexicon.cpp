@@ -0,0 +1,136 @@
+#include "kinepredict/text_processing/SentimentLexicon.h"
+#include <iostream>
+#include <cassert>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace kinepredict;
+
+void testBuiltinLexicon() {
+    const SentimentLexicon& lexicon = SentimentLexicon::builtin();
+    assert(&lexicon == &SentimentLexicon::builtin());
+    assert(lexicon.size() > 250);
+
+    assert(lexicon.find("amazing").value() > 0);
+    assert(lexicon.find("terrible").value() < 0);
+    assert(lexicon.find("table").has_value() == false);
+    assert(lexicon.find("").has_value() == false);
+    assert(lexicon.find("Amazing").has_value() == false);   // Tokens are expected normalized
+
+    assert(lexicon.isNegator("not"));
+    assert(lexicon.isNegator("don't"));
+    assert(lexicon.isNegator("great") == false);
+    assert(lexicon.find("not").has_value() == false);
+
+    std::cout << "✓ Builtin lexicon test passed" << std::endl;
+}
+
+void testScoring() {
+    const SentimentLexicon& lexicon = SentimentLexicon::builtin();
+    SentimentLexicon::Scratch scratch;
+
+    SentimentScore positive = lexicon.score("Amazing deals on GREAT shoes!", scratch);
+    assert(positive.tokens == 5);
+    assert(positive.positive == 2 && positive.negative == 0);   // "deals" is not in the lexicon
+    assert(positive.score == *lexicon.find("amazing") + *lexicon.find("great"));
+    assert(std::abs(positive.comparative() - positive.score / 5) < 1e-12);
+
+    SentimentScore negative = lexicon.score("Worst customer service ever", scratch);
+    assert(negative.score < 0 && negative.negative == 1);
+
+    SentimentScore empty = lexicon.score("", scratch);
+    assert(empty.tokens == 0 && empty.score == 0 && empty.comparative() == 0);
+
+    std::cout << "✓ Scoring test passed" << std::endl;
+}
+
+void testNegationWindow() {
+    const SentimentLexicon& lexicon = SentimentLexicon::builtin();
+    SentimentLexicon::Scratch scratch;
+    float great = *lexicon.find("great");
+    float bad = *lexicon.find("bad");
+
+    assert(lexicon.score("not great", scratch).score == -great);
+    assert(lexicon.score("Don't miss this great deal", scratch).score ==
+           -great + *lexicon.find("deal"));
+
+    // Window of 3 tokens after the negator
+    assert(lexicon.score("not a single bad review", scratch).score == -bad);
+    assert(lexicon.score("not one of the bad ones", scratch).score == bad);
+
+    // A second negator restarts the window
+    assert(lexicon.score("never not bad", scratch).score == -bad);
+
+    SentimentLexicon wide({{"good", 2}, {"nope", 0, true}}, 10);
+    assert(wide.score("nope it is really truly very extremely good", scratch).score == -2);
+    SentimentLexicon none({{"good", 2}, {"nope", 0, true}}, 0);
+    assert(none.score("nope good", scratch).score == 2);
+
+    std::cout << "✓ Negation window test passed" << std::endl;
+}
+
+void testCustomLexicon() {
+    // Words are normalized on the way in
+    SentimentLexicon lexicon({{"Good", 2}, {"BAD!", -2}, {"meh", -0.5f}});
+    assert(lexicon.size() == 3);
+    assert(lexicon.find("good").value() == 2);
+    assert(lexicon.find("bad").value() == -2);
+    assert(lexicon.find("meh").value() == -0.5f);
+    assert(lexicon.find("fine").has_value() == false);
+
+    bool threw = false;
+    try { SentimentLexicon duplicate({{"good", 1}, {"GOOD", 2}}); } catch (const std::invalid_argument&) { threw = true; }
+    assert(threw);
+    threw = false;
+    try { SentimentLexicon phrase({{"very good", 1}}); } catch (const std::invalid_argument&) { threw = true; }
+    assert(threw);
+    threw = false;
+    try { SentimentLexicon blank({{"?!", 1}}); } catch (const std::invalid_argument&) { threw = true; }
+    assert(threw);
+
+    SentimentLexicon empty({});
+    assert(empty.size() == 0);
+    assert(empty.find("good").has_value() == false);
+    std::vector<std::string_view> tokens = {"good", "day"};
+    assert(empty.score(tokens).score == 0 && empty.score(tokens).tokens == 2);
+
+    std::cout << "✓ Custom lexicon test passed" << std::endl;
+}
+
+void testLargeLexiconIsMinimalAndExact() {
+    const size_t n = 50000;
+    std::vector<std::string> words;
+    for (size_t i = 0; i < n; i++) {
+        words.push_back("word" + std::to_string(i));
+    }
+    std::vector<LexiconEntry> entries;
+    for (size_t i = 0; i < n; i++) {
+        entries.push_back({words[i], static_cast<float>(i % 11) - 5});
+    }
+    SentimentLexicon lexicon(entries);
+    assert(lexicon.size() == n);   // One slot per word
+
+    for (size_t i = 0; i < n; i++) {
+        assert(lexicon.find(words[i]).value() == static_cast<float>(i % 11) - 5);
+    }
+    for (size_t i = n; i < 2 * n; i++) {
+        assert(lexicon.find("word" + std::to_string(i)).has_value() == false);
+    }
+
+    std::cout << "✓ Large lexicon test passed" << std::endl;
+}
+
+int main() {
+    std::cout << "Running Sentiment Lexicon tests..." << std::endl;
+
+    testBuiltinLexicon();
+    testScoring();
+    testNegationWindow();
+    testCustomLexicon();
+    testLargeLexiconIsMinimalAndExact();
+
+    std::cout << "\n✅ All Sentiment Lexicon tests passed!" << std::endl;
+    return 0;
+}
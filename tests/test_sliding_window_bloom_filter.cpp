@@ -0,0 +1,161 @@
+#include "kinepredict/data_structures/SlidingWindowBloomFilter.h"
+#include <iostream>
+#include <cassert>
+#include <string>
+#include <cmath>
+
+using namespace kinepredict;
+using namespace std::chrono_literals;
+
+using Clock = SlidingWindowBloomFilter::Clock;
+
+void testSlidingWindowBasic() {
+    Clock::time_point t0{};
+    SlidingWindowBloomFilter bloom(24h, 1.0, 0.01, 24, t0);
+    
+    bloom.add("marketing", t0);
+    bloom.add("content", t0 + 1h);
+    
+    assert(bloom.contains("marketing") == true);
+    assert(bloom.contains("content") == true);
+    assert(bloom.contains("nonexistent") == false);
+    assert(bloom.getElementCount() == 2);
+    
+    std::cout << "✓ Basic Sliding Window Bloom Filter test passed" << std::endl;
+}
+
+void testSlidingWindowExpiry() {
+    Clock::time_point t0{};
+    SlidingWindowBloomFilter bloom(24h, 1.0, 0.01, 24, t0);
+    
+    bloom.add("old headline", t0);
+    bloom.add("newer headline", t0 + 12h);
+    
+    // Still inside the window
+    bloom.advance(t0 + 24h);
+    assert(bloom.contains("old headline") == true);
+    
+    // One generation past the window the old one is gone, the newer one stays
+    bloom.advance(t0 + 25h);
+    assert(bloom.contains("old headline") == false);
+    assert(bloom.contains("newer headline") == true);
+    assert(bloom.getElementCount() == 1);
+    
+    // Long idle gap expires everything
+    bloom.advance(t0 + 100h);
+    assert(bloom.contains("newer headline") == false);
+    assert(bloom.getElementCount() == 0);
+    
+    std::cout << "✓ Sliding Window Bloom Filter expiry test passed" << std::endl;
+}
+
+void testSlidingWindowRemove() {
+    Clock::time_point t0{};
+    SlidingWindowBloomFilter bloom(1h, 100.0, 0.01, 6, t0);
+    
+    for (int i = 0; i < 1000; i++) {
+        bloom.add("item" + std::to_string(i), t0 + std::chrono::seconds(i));
+    }
+    
+    assert(bloom.remove("item500") == true);
+    assert(bloom.contains("item500") == false);
+    assert(bloom.remove("item500") == false);
+    assert(bloom.remove("never added") == false);
+    assert(bloom.getElementCount() == 999);
+    
+    // Adding it again cancels the removal
+    bloom.add("item500", t0 + 1000s);
+    assert(bloom.contains("item500") == true);
+    assert(bloom.remove("item500") == true);
+    assert(bloom.contains("item500") == false);
+    
+    // Removing one element never hides another
+    for (int i = 0; i < 1000; i++) {
+        if (i != 500) assert(bloom.contains("item" + std::to_string(i)));
+    }
+    
+    std::cout << "✓ Sliding Window Bloom Filter remove test passed" << std::endl;
+}
+
+void testSlidingWindowSteadyState() {
+    // 10 inserts/s over a 1000s window, run for 5 windows with no resets
+    Clock::time_point t0{};
+    SlidingWindowBloomFilter bloom(1000s, 10.0, 0.01, 10, t0);
+    
+    const int total = 50000;
+    for (int i = 0; i < total; i++) {
+        bloom.add("item" + std::to_string(i), t0 + std::chrono::milliseconds(i * 100));
+    }
+    
+    // Everything from the last window is present
+    for (int i = total - 10000; i < total; i++) {
+        assert(bloom.contains("item" + std::to_string(i)));
+    }
+    
+    // Old elements are mostly gone, unseen ones mostly absent
+    int oldHits = 0;
+    int unseenHits = 0;
+    for (int i = 0; i < 10000; i++) {
+        oldHits += bloom.contains("item" + std::to_string(i));
+        unseenHits += bloom.contains("unseen" + std::to_string(i));
+    }
+    std::cout << "  Expired hit rate: " << oldHits / 10000.0
+              << ", false positive rate: " << unseenHits / 10000.0 << std::endl;
+    assert(oldHits < 500);
+    assert(unseenHits < 500);
+    assert(bloom.getElementCount() <= 11000);
+    
+    std::cout << "✓ Sliding Window Bloom Filter steady state test passed" << std::endl;
+}
+
+void testSlidingWindowMemoryAndLongRunFpr() {
+    // 100 inserts/s over a 1000s window: 100k elements live at a time
+    Clock::time_point t0{};
+    const double rate = 100.0;
+    const size_t perWindow = 100000;
+    SlidingWindowBloomFilter bloom(1000s, rate, 0.01, 24, t0);
+
+    // Two plain 1% filters side by side cost 2 * 1.44 * log2(100) bits per element
+    double plainPairBits = 2 * -std::log(0.01) / (std::log(2) * std::log(2));
+    double bitsPerElement = bloom.getMemoryUsage() * 8.0 / perWindow;
+    std::cout << "  Memory: " << bitsPerElement << " bits per windowed element (two plain filters: "
+              << plainPairBits << ")" << std::endl;
+    assert(bitsPerElement < plainPairBits);
+
+    // Six full window turnovers; the FPR must not creep up over time
+    size_t next = 0;
+    for (int turnover = 1; turnover <= 6; turnover++) {
+        for (size_t i = 0; i < perWindow; i++, next++) {
+            bloom.add("item" + std::to_string(next), t0 + std::chrono::milliseconds(next * 10));
+        }
+        int falsePositives = 0;
+        for (int i = 0; i < 20000; i++) {
+            falsePositives += bloom.contains("unseen" + std::to_string(turnover) + "-" + std::to_string(i));
+        }
+        double fpr = falsePositives / 20000.0;
+        if (turnover == 1 || turnover == 6) {
+            std::cout << "  FPR after " << turnover << " windows: " << fpr << std::endl;
+        }
+        assert(fpr < 0.015);
+    }
+    for (size_t i = next - perWindow; i < next; i++) {
+        assert(bloom.contains("item" + std::to_string(i)));
+    }
+    assert(bloom.getElementCount() <= perWindow + perWindow / 24 + 1);
+    assert(bloom.getFalsePositiveRate() < 0.015);
+
+    std::cout << "✓ Sliding Window Bloom Filter memory and long-run FPR test passed" << std::endl;
+}
+
+int main() {
+    std::cout << "Running Sliding Window Bloom Filter tests..." << std::endl;
+    
+    testSlidingWindowBasic();
+    testSlidingWindowExpiry();
+    testSlidingWindowRemove();
+    testSlidingWindowSteadyState();
+    testSlidingWindowMemoryAndLongRunFpr();
+    
+    std::cout << "\n✅ All Sliding Window Bloom Filter tests passed!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,251 @@
+#include "kinepredict/text_processing/TextProcessor.h"
+#include "kinepredict/core/Hash.h"
+#include <iostream>
+#include <cassert>
+#include <stdexcept>
+
+using namespace kinepredict;
+
+using Tokens = std::vector<std::string_view>;
+
+void testTokenizeBasic() {
+    assert((TextProcessor::tokenize("Buy Now - 50% Off!") == Tokens{"Buy", "Now", "50", "Off"}));
+    assert((TextProcessor::tokenize("  leading,trailing...  ") == Tokens{"leading", "trailing"}));
+    assert(TextProcessor::tokenize("").empty());
+    assert(TextProcessor::tokenize(" \t\n!?").empty());
+    
+    std::cout << "✓ Tokenize basic test passed" << std::endl;
+}
+
+void testTokenizeZeroCopy() {
+    std::string headline = "Limited Time Offer";
+    std::vector<std::string_view> tokens;
+    TextProcessor::tokenize(headline, tokens);
+    
+    assert(tokens.size() == 3);
+    assert(tokens[0].data() == headline.data());
+    assert(tokens[2].data() == headline.data() + 13);
+    
+    // The output buffer is cleared and reused
+    TextProcessor::tokenize("one", tokens);
+    assert((tokens == Tokens{"one"}));
+    
+    std::cout << "✓ Tokenize zero-copy test passed" << std::endl;
+}
+
+void testTokenizeApostrophes() {
+    assert((TextProcessor::tokenize("Don't miss it's 'quoted' words'") ==
+            Tokens{"Don't", "miss", "it's", "quoted", "words"}));
+    assert((TextProcessor::tokenize("don’t ‘quote’") == Tokens{"don’t", "quote"}));
+    
+    std::cout << "✓ Tokenize apostrophe test passed" << std::endl;
+}
+
+void testTokenizeUtf8() {
+    // Accented and non-Latin letters are word characters
+    assert((TextProcessor::tokenize("Café crème, Привет мир!") == Tokens{"Café", "crème", "Привет", "мир"}));
+    // Unicode dashes, ellipses, no-break and thin spaces separate tokens
+    assert((TextProcessor::tokenize("sale\u2014today\u2026now\u00A0free\u2009deal") ==
+            Tokens{"sale", "today", "now", "free", "deal"}));
+    // Malformed bytes separate tokens; a truncated sequence doesn't read past the end
+    assert((TextProcessor::tokenize("bad\xFF" "byte \xC0\xAF ok \xE2\x80") == Tokens{"bad", "byte", "ok"}));
+    
+    std::cout << "✓ Tokenize UTF-8 test passed" << std::endl;
+}
+
+void testWordAndCharCount() {
+    assert(TextProcessor::wordCount("Buy Now - 50% Off!") == 4);
+    assert(TextProcessor::wordCount("") == 0);
+    assert(TextProcessor::wordCount("Don't stop") == 2);
+    
+    assert(TextProcessor::charCount("Buy Now!") == 7);
+    assert(TextProcessor::charCount(" \t\n") == 0);
+    assert(TextProcessor::charCount("Café crème") == 9);  // Code points, not bytes
+    assert(TextProcessor::charCount("a\u00A0b\u2009c") == 3);  // Unicode spaces skipped
+    
+    std::cout << "✓ Word and char count test passed" << std::endl;
+}
+
+void testNormalize() {
+    std::string buffer;
+    std::vector<std::string_view> tokens;
+    
+    TextProcessor::normalize("Buy NOW - 50% Off!!  Don't Wait", buffer, tokens);
+    assert(buffer == "buy now 50 off don't wait");
+    assert((tokens == Tokens{"buy", "now", "50", "off", "don't", "wait"}));
+    assert(tokens[1].data() == buffer.data() + 4);
+    
+    // Long ASCII runs cross the 16/32-byte vector blocks
+    std::string longRun = "ABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789abcdefghijklmnopqrstuvwxyzXYZ!tail";
+    TextProcessor::normalize(longRun, buffer, tokens);
+    assert(buffer == "abcdefghijklmnopqrstuvwxyz0123456789abcdefghijklmnopqrstuvwxyzxyz tail");
+    assert(tokens.size() == 2);
+    
+    TextProcessor::normalize("", buffer, tokens);
+    assert(buffer.empty() && tokens.empty());
+    TextProcessor::normalize("?!...", buffer, tokens);
+    assert(buffer.empty() && tokens.empty());
+    
+    std::cout << "✓ Normalize test passed" << std::endl;
+}
+
+void testNormalizeUtf8() {
+    std::string buffer;
+    std::vector<std::string_view> tokens;
+    
+    TextProcessor::normalize("ÉTÉ Ça COÛTE — «SOLDES» ŁÓDŹ", buffer, tokens);
+    assert(buffer == "été ça coûte soldes łódź");
+    
+    TextProcessor::normalize("СКИДКИ до 50%! ΕΛΛΑΔΑ Ёлка", buffer, tokens);
+    assert(buffer == "скидки до 50 ελλαδα ёлка");
+    
+    // Curly apostrophe folds to ', malformed bytes are dropped, CJK passes through
+    TextProcessor::normalize("DON’T\xFFMiss 東京、セール", buffer, tokens);
+    assert(buffer == "don't miss 東京 セール");
+    assert(tokens.size() == 4);
+    
+    std::cout << "✓ Normalize UTF-8 test passed" << std::endl;
+}
+
+void testNormalizeMatchesThreePasses() {
+    const char* headlines[] = {
+        "Limited Time: 50% OFF Everything!",
+        "Café CRÈME — l'offre du jour…",
+        "Top 10 Tips (You Won't Believe #7)",
+        "Новинки Сезона: Скидки До 70%",
+        "'quoted' words' and ''double''",
+        "buy.now",
+        "e-mail 50%OFF",
+        "a—b",
+        "Don't—stop\xFFnow a''b",
+    };
+    std::string buffer;
+    std::vector<std::string_view> tokens;
+    for (const char* headline : headlines) {
+        TextProcessor::normalize(headline, buffer, tokens);
+        std::string stripped = TextProcessor::removePunctuation(TextProcessor::toLowerCase(headline));
+        assert(tokens == TextProcessor::tokenize(stripped));
+    }
+    
+    assert(TextProcessor::toLowerCase("HeLLo ÀÉÎ ΣΩ") == "hello àéî σω");
+    assert(TextProcessor::toLowerCase("keep\xFF") == "keep\xFF");
+    assert(TextProcessor::removePunctuation("Hi, there! Don't—stop.") == "Hi there Don't stop");
+    assert(TextProcessor::removePunctuation("buy.now e-mail 50%OFF a—b") == "buy now e mail 50 OFF a b");
+    
+    TextProcessor::normalize("buy.now e-mail 50%OFF a—b", buffer, tokens);
+    assert(buffer == "buy now e mail 50 off a b");
+    
+    std::cout << "✓ Normalize matches three passes test passed" << std::endl;
+}
+
+void testExtractNGrams() {
+    auto tokens = TextProcessor::tokenize("flash sale ends tonight");
+    
+    auto bigrams = TextProcessor::extractNGrams(tokens, 2);
+    assert(bigrams.size() == 3);
+    assert(bigrams[0] == "flash sale");
+    assert(bigrams[2] == "ends tonight");
+    
+    assert(TextProcessor::extractNGrams(tokens, 1).size() == 4);
+    assert(TextProcessor::extractNGrams(tokens, 4)[0] == "flash sale ends tonight");
+    assert(TextProcessor::extractNGrams(tokens, 5).empty());
+    assert(TextProcessor::extractNGrams(tokens, 0).empty());
+    
+    std::cout << "✓ Extract n-grams test passed" << std::endl;
+}
+
+void testHashNGrams() {
+    auto tokens = TextProcessor::tokenize("big summer sale big summer deals");
+    std::vector<uint64_t> ids;
+    
+    // 6 unigrams + 5 bigrams + 4 trigrams, ordered by end token
+    TextProcessor::hashNGrams(tokens, 1, 3, ids);
+    assert(ids.size() == 15);
+    assert(ids[0] == hash64("big"));
+    assert(ids[1] == hash64("summer"));
+    assert(ids[2] == hashCombine(hash64("big"), hash64("summer")));
+    uint64_t bigSummerSale = hashCombine(hashCombine(hash64("big"), hash64("summer")), hash64("sale"));
+    assert(ids[5] == bigSummerSale);
+    
+    // Same gram, same ID regardless of position; order matters
+    std::vector<uint64_t> bigrams;
+    TextProcessor::hashNGrams(tokens, 2, 2, bigrams);
+    assert(bigrams.size() == 5);
+    assert(bigrams[0] == bigrams[3]);                   // "big summer" twice
+    assert(bigrams[0] != bigrams[2]);                   // vs "sale big"
+    assert(bigrams[1] != hashCombine(hash64("sale"), hash64("summer")));
+    
+    // Every ID matches hashing the extracted gram's tokens directly
+    for (size_t n = 1; n <= 3; n++) {
+        TextProcessor::hashNGrams(tokens, n, n, ids);
+        auto grams = TextProcessor::extractNGrams(tokens, n);
+        assert(ids.size() == grams.size());
+        for (size_t i = 0; i < grams.size(); i++) {
+            auto gramTokens = TextProcessor::tokenize(grams[i]);
+            uint64_t expected = hash64(gramTokens[0]);
+            for (size_t t = 1; t < gramTokens.size(); t++) {
+                expected = hashCombine(expected, hash64(gramTokens[t]));
+            }
+            assert(ids[i] == expected);
+        }
+    }
+    
+    // Short input and buffer reuse
+    TextProcessor::hashNGrams(TextProcessor::tokenize("sale"), 2, 4, ids);
+    assert(ids.empty());
+    
+    std::cout << "✓ Hash n-grams test passed" << std::endl;
+}
+
+void testHashNGramsBucketed() {
+    auto tokens = TextProcessor::tokenize("new arrivals every week at the outlet store");
+    std::vector<uint64_t> ids;
+    std::vector<uint32_t> buckets;
+    
+    TextProcessor::hashNGrams(tokens, 1, 2, ids);
+    TextProcessor::hashNGrams(tokens, 1, 2, 64, buckets);
+    assert(buckets.size() == ids.size());
+    for (size_t i = 0; i < ids.size(); i++) {
+        assert(buckets[i] < 64);
+        assert(buckets[i] == static_cast<uint32_t>(((ids[i] >> 32) * 64) >> 32));
+    }
+    
+    TextProcessor::hashNGrams(tokens, 1, 1, 1, buckets);
+    for (uint32_t bucket : buckets) {
+        assert(bucket == 0);
+    }
+    
+    bool threw = false;
+    try { TextProcessor::hashNGrams(tokens, 0, 2, ids); } catch (const std::invalid_argument&) { threw = true; }
+    assert(threw);
+    threw = false;
+    try { TextProcessor::hashNGrams(tokens, 3, 2, ids); } catch (const std::invalid_argument&) { threw = true; }
+    assert(threw);
+    threw = false;
+    try { TextProcessor::hashNGrams(tokens, 1, TextProcessor::kMaxHashedNGram + 1, ids); } catch (const std::invalid_argument&) { threw = true; }
+    assert(threw);
+    threw = false;
+    try { TextProcessor::hashNGrams(tokens, 1, 2, 0, buckets); } catch (const std::invalid_argument&) { threw = true; }
+    assert(threw);
+    
+    std::cout << "✓ Hash n-grams bucketed test passed" << std::endl;
+}
+
+int main() {
+    std::cout << "Running Text Processor tests..." << std::endl;
+    
+    testTokenizeBasic();
+    testTokenizeZeroCopy();
+    testTokenizeApostrophes();
+    testTokenizeUtf8();
+    testWordAndCharCount();
+    testNormalize();
+    testNormalizeUtf8();
+    testNormalizeMatchesThreePasses();
+    testExtractNGrams();
+    testHashNGrams();
+    testHashNGramsBucketed();
+    
+    std::cout << "\n✅ All Text Processor tests passed!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,227 @@
+#include "kinepredict/text_processing/TfidfVectorizer.h"
+#include <iostream>
+#include <cassert>
+#include <atomic>
+#include <cmath>
+#include <cstdlib>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace kinepredict;
+
+// Count heap allocations to check that transform() allocates nothing;
+// failingAllocation, when set, makes that allocation throw
+static std::atomic<size_t> allocationCount{0};
+static std::atomic<size_t> failingAllocation{0};
+
+void* operator new(size_t size) {
+    size_t count = ++allocationCount;
+    if (count == failingAllocation.load()) {
+        throw std::bad_alloc();
+    }
+    if (void* memory = std::malloc(size ? size : 1)) {
+        return memory;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* memory) noexcept {
+    std::free(memory);
+}
+
+void operator delete(void* memory, size_t) noexcept {
+    std::free(memory);
+}
+
+namespace {
+
+const std::vector<std::string_view> kHeadlines = {
+    "Big Summer Sale: 50% Off Dresses",
+    "Summer sale on shoes and dresses",
+    "New arrivals: fall boots",
+    "Big savings on fall boots this weekend",
+};
+
+double squaredNorm(const std::vector<float>& values) {
+    double sum = 0.0;
+    for (float value : values) sum += static_cast<double>(value) * value;
+    return sum;
+}
+
+} // namespace
+
+void testTfidfVocabulary() {
+    TfidfVectorizer vectorizer;
+    vectorizer.fit(kHeadlines, 1);
+    assert(vectorizer.documentCount() == 4);
+
+    // big summer sale 50 off dresses on shoes and new arrivals fall boots
+    // savings this weekend
+    assert(vectorizer.vocabularySize() == 16);
+
+    auto summer = vectorizer.termColumn("Summer");
+    auto boots = vectorizer.termColumn("boots");
+    auto weekend = vectorizer.termColumn("WEEKEND");
+    assert(summer && boots && weekend);
+    assert(vectorizer.documentFrequency(*summer) == 2);
+    assert(vectorizer.documentFrequency(*weekend) == 1);
+    assert(vectorizer.termColumn("winter").has_value() == false);
+    assert(vectorizer.termColumn("summer sale").has_value() == false);   // Unigrams only
+
+    // Columns are ordered by document frequency; rarer terms weigh more
+    assert(*summer < *weekend);
+    assert(vectorizer.idf(*weekend) > vectorizer.idf(*summer));
+    assert(std::abs(vectorizer.idf(*summer) - static_cast<float>(std::log(5.0 / 3.0) + 1.0)) < 1e-6f);
+
+    // Bigrams, frequency floor and feature cap
+    TfidfVectorizer bigrams(2, 2);
+    bigrams.fit(kHeadlines, 1);
+    assert(bigrams.termColumn("summer sale").has_value());
+    assert(bigrams.termColumn("fall boots").has_value());
+    assert(bigrams.termColumn("weekend").has_value() == false);           // Only in one document
+    assert(bigrams.vocabularySize() == 9);    // big summer sale on dresses fall boots + 2 bigrams
+
+    TfidfVectorizer capped(1, 1, 3);
+    capped.fit(kHeadlines, 1);
+    assert(capped.vocabularySize() == 3);
+
+    bool threw = false;
+    try { TfidfVectorizer bad(0); } catch (const std::invalid_argument&) { threw = true; }
+    assert(threw);
+
+    std::cout << "✓ TF-IDF vocabulary test passed" << std::endl;
+}
+
+void testTfidfTransform() {
+    TfidfVectorizer vectorizer;
+    vectorizer.fit(kHeadlines, 1);
+
+    TfidfVectorizer::Scratch scratch;
+    std::vector<uint32_t> columns;
+    std::vector<float> values;
+    vectorizer.transform("Sale! Sale! Summer boots, winter coats", scratch, columns, values);
+
+    // sale, summer, boots are known; winter and coats are not
+    assert(columns.size() == 3);
+    for (size_t i = 1; i < columns.size(); i++) {
+        assert(columns[i - 1] < columns[i]);
+    }
+    assert(std::abs(squaredNorm(values) - 1.0) < 1e-5);
+
+    // sale appears twice with the same IDF as summer
+    uint32_t sale = *vectorizer.termColumn("sale");
+    uint32_t summer = *vectorizer.termColumn("summer");
+    auto weightOf = [&](uint32_t column) {
+        for (size_t i = 0; i < columns.size(); i++) {
+            if (columns[i] == column) return values[i];
+        }
+        return 0.0f;
+    };
+    assert(std::abs(weightOf(sale) - 2 * weightOf(summer)) < 1e-5f);
+
+    vectorizer.transform("nothing known here", scratch, columns, values);
+    assert(columns.empty() && values.empty());
+
+    // Once the scratch buffers have grown, a transform allocates nothing
+    vectorizer.transform("Big Summer Sale: 50% Off Dresses this weekend", scratch, columns, values);
+    size_t before = allocationCount.load();
+    vectorizer.transform("Summer sale on big fall boots", scratch, columns, values);
+    assert(allocationCount == before);
+    assert(!columns.empty());
+
+    std::cout << "✓ TF-IDF transform test passed" << std::endl;
+}
+
+void testTfidfParallelMatchesSerial() {
+    std::vector<std::string> corpus;
+    const char* words[] = {"sale", "summer", "boots", "new", "free", "shipping", "today", "only",
+                           "dresses", "deal", "flash", "weekend", "big", "save", "off", "now"};
+    uint64_t state = 12345;
+    for (int i = 0; i < 2000; i++) {
+        std::string headline;
+        for (int w = 0; w < 6; w++) {
+            state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+            headline += std::string(words[(state >> 33) % 16]) + " ";
+        }
+        corpus.push_back(headline);
+    }
+    std::vector<std::string_view> documents(corpus.begin(), corpus.end());
+
+    TfidfVectorizer serial(2);
+    TfidfVectorizer parallel(2);
+    serial.fit(documents, 1);
+    parallel.fit(documents, 4);
+    assert(serial.vocabularySize() == parallel.vocabularySize());
+    for (uint32_t column = 0; column < serial.vocabularySize(); column++) {
+        assert(serial.documentFrequency(column) == parallel.documentFrequency(column));
+    }
+    assert(serial.termColumn("flash sale") == parallel.termColumn("flash sale"));
+
+    SparseMatrix one = serial.transform(documents, 1);
+    SparseMatrix four = parallel.transform(documents, 4);
+    assert(one.rows() == documents.size() && four.rows() == documents.size());
+    assert(one.numColumns == serial.vocabularySize());
+    assert(one.rowOffsets == four.rowOffsets);
+    assert(one.indices == four.indices);
+    assert(one.values == four.values);
+
+    // Each row matches the single-document transform
+    TfidfVectorizer::Scratch scratch;
+    std::vector<uint32_t> columns;
+    std::vector<float> values;
+    for (size_t row = 0; row < documents.size(); row += 97) {
+        serial.transform(documents[row], scratch, columns, values);
+        size_t begin = one.rowOffsets[row];
+        size_t end = one.rowOffsets[row + 1];
+        assert(end - begin == columns.size());
+        for (size_t i = 0; i < columns.size(); i++) {
+            assert(one.indices[begin + i] == columns[i]);
+            assert(one.values[begin + i] == values[i]);
+        }
+    }
+
+    SparseMatrix empty = serial.transform(std::vector<std::string_view>{}, 4);
+    assert(empty.rows() == 0 && empty.nonZeros() == 0);
+
+    std::cout << "✓ TF-IDF parallel matches serial test passed" << std::endl;
+}
+
+void testTfidfWorkerFailurePropagates() {
+    std::vector<std::string> corpus;
+    for (int i = 0; i < 400; i++) {
+        corpus.push_back("headline number " + std::to_string(i) + " with summer sale words");
+    }
+    std::vector<std::string_view> documents(corpus.begin(), corpus.end());
+
+    // Fail an allocation partway through, on whichever thread makes it;
+    // the exception must reach the caller instead of terminating
+    for (size_t after : {1, 20, 200, 2000}) {
+        TfidfVectorizer vectorizer(2);
+        bool threw = false;
+        failingAllocation = allocationCount.load() + after;
+        try {
+            vectorizer.fit(documents, 4);
+            SparseMatrix matrix = vectorizer.transform(documents, 4);
+        } catch (const std::bad_alloc&) {
+            threw = true;
+        }
+        failingAllocation = 0;
+        assert(threw);
+    }
+
+    std::cout << "✓ TF-IDF worker failure propagates test passed" << std::endl;
+}
+
+int main() {
+    std::cout << "Running TF-IDF Vectorizer tests..." << std::endl;
+
+    testTfidfVocabulary();
+    testTfidfTransform();
+    testTfidfParallelMatchesSerial();
+    testTfidfWorkerFailurePropagates();
+
+    std::cout << "\n✅ All TF-IDF Vectorizer tests passed!" << std::endl;
+    return 0;
+}
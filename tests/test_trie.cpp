@@ -1,6 +1,11 @@
 #include "kinepredict/data_structures/Trie.h"
 #include <iostream>
 #include <cassert>
+#include <memory_resource>
+#include <utility>
+#include <algorithm>
+#include <random>
+#include <cstdint>
 
 using namespace kinepredict;
 
@@ -63,6 +68,260 @@ void testTrieSize() {
     std::cout << "✓ Trie size test passed" << std::endl;
 }
 
+void testTrieClearAndReuse() {
+    Trie trie;
+    for (int i = 0; i < 10000; i++) {
+        trie.insert("keyword" + std::to_string(i));
+    }
+    assert(trie.size() == 10000);
+    
+    trie.clear();
+    assert(trie.size() == 0);
+    assert(trie.search("keyword1") == false);
+    assert(trie.startsWith("key") == false);
+    
+    trie.insert("reloaded");
+    assert(trie.search("reloaded") == true);
+    assert(trie.size() == 1);
+    
+    std::cout << "✓ Trie clear and reuse test passed" << std::endl;
+}
+
+void testTrieWideFanOut() {
+    // Every byte value under one node, inserted out of order twice
+    Trie trie;
+    for (int round = 0; round < 2; round++) {
+        for (int i = 0; i < 256; i++) {
+            trie.insert(std::string("x") + static_cast<char>((i * 97) % 256));
+        }
+    }
+    assert(trie.size() == 256);
+    for (int i = 0; i < 256; i++) {
+        assert(trie.search(std::string("x") + static_cast<char>(i)) == true);
+    }
+    assert(trie.getWordsWithPrefix("x").size() == 256);
+    
+    std::cout << "✓ Trie wide fan-out test passed" << std::endl;
+}
+
+void testTrieLongKey() {
+    // Deep enough to overflow the stack with recursive node teardown
+    std::string longKey(1000000, 'a');
+    {
+        Trie trie;
+        trie.insert(longKey);
+        assert(trie.search(longKey) == true);
+        assert(trie.search(longKey.substr(1)) == false);
+        assert(trie.getWordsWithPrefix("aaa").size() == 1);
+        trie.clear();
+        trie.insert(longKey);
+    }
+    
+    std::cout << "✓ Trie long key test passed" << std::endl;
+}
+
+void testTrieMemoryResource() {
+    std::pmr::monotonic_buffer_resource arena;
+    Trie trie(&arena);
+    
+    trie.insert("market");
+    trie.insert("marketing");
+    trie.insert("markets");
+    assert(trie.search("marketing") == true);
+    assert(trie.getWordsWithPrefix("market").size() == 3);
+    
+    // Moving keeps the nodes and the resource
+    Trie moved(std::move(trie));
+    assert(moved.search("markets") == true);
+    assert(moved.size() == 3);
+    
+    std::cout << "✓ Trie memory resource test passed" << std::endl;
+}
+
+void testTrieTopK() {
+    Trie trie;
+    trie.insert("buy", 5.0f);
+    trie.insert("buying", 9.0f);
+    trie.insert("buyer", 2.0f);
+    trie.insert("brand", 7.0f);
+    trie.insert("bundle", 1.0f);
+    trie.insert("sale", 10.0f);
+    trie.insert("bu");  // Unweighted words score 0
+    
+    auto top = trie.topK("b", 3);
+    assert(top.size() == 3);
+    assert(top[0].word == "buying" && top[0].weight == 9.0f);
+    assert(top[1].word == "brand");
+    assert(top[2].word == "buy");
+    
+    assert(trie.topK("bu", 10).size() == 5);
+    assert(trie.topK("bu", 10).back().word == "bu");
+    assert(trie.topK("x", 3).empty());
+    assert(trie.topK("b", 0).empty());
+    assert(trie.topK("", 1)[0].word == "sale");
+    
+    // Re-weighting moves a word both up and down the ranking
+    trie.insert("buying", 0.5f);
+    assert(trie.topK("b", 1)[0].word == "brand");
+    trie.insert("bundle", 20.0f);
+    assert(trie.topK("b", 1)[0].word == "bundle");
+    
+    // Plain insert keeps an existing weight
+    trie.insert("bundle");
+    assert(trie.topK("b", 1)[0].weight == 20.0f);
+    assert(trie.size() == 7);
+    
+    std::cout << "✓ Trie top-K test passed" << std::endl;
+}
+
+void testTrieCompletionsMatchSort() {
+    // Random weights, including lowered ones, against a full sort
+    std::mt19937 rng(11);
+    std::uniform_int_distribution<int> letter('a', 'd');
+    std::uniform_int_distribution<int> length(1, 7);
+    std::uniform_real_distribution<float> score(-100.0f, 100.0f);
+    
+    Trie trie;
+    std::vector<std::pair<std::string, float>> weights;
+    for (int i = 0; i < 3000; i++) {
+        std::string word;
+        int len = length(rng);
+        for (int j = 0; j < len; j++) word.push_back(static_cast<char>(letter(rng)));
+        float weight = score(rng);
+        trie.insert(word, weight);
+        
+        auto it = std::find_if(weights.begin(), weights.end(),
+                               [&](const auto& entry) { return entry.first == word; });
+        if (it != weights.end()) it->second = weight;
+        else weights.emplace_back(word, weight);
+    }
+    
+    for (const char* prefix : {"", "a", "bc", "dda"}) {
+        std::vector<float> expected;
+        for (const auto& [word, weight] : weights) {
+            if (word.compare(0, std::string(prefix).size(), prefix) == 0) expected.push_back(weight);
+        }
+        std::sort(expected.rbegin(), expected.rend());
+        
+        // Page through the lazy cursor
+        Trie::Completions cursor = trie.completions(prefix);
+        std::vector<float> paged;
+        while (auto completion = cursor.next()) {
+            assert(completion->word.compare(0, std::string(prefix).size(), prefix) == 0);
+            assert(trie.search(completion->word));
+            paged.push_back(completion->weight);
+        }
+        assert(paged == expected);
+        
+        auto top = trie.topK(prefix, 10);
+        assert(top.size() == std::min<size_t>(10, expected.size()));
+        for (size_t i = 0; i < top.size(); i++) {
+            assert(top[i].weight == expected[i]);
+        }
+    }
+    
+    std::cout << "✓ Trie completions match sort test passed" << std::endl;
+}
+
+void testTrieWordsWithPrefixSorted() {
+    Trie trie;
+    for (const char* word : {"card", "car", "cat", "ca", "dog"}) {
+        trie.insert(word);
+    }
+    auto words = trie.getWordsWithPrefix("ca");
+    assert((words == std::vector<std::string>{"ca", "car", "card", "cat"}));
+    
+    std::cout << "✓ Trie words with prefix order test passed" << std::endl;
+}
+
+size_t editDistance(const std::string& a, const std::string& b) {
+    std::vector<size_t> row(b.size() + 1);
+    for (size_t j = 0; j <= b.size(); j++) row[j] = j;
+    for (size_t i = 1; i <= a.size(); i++) {
+        size_t diagonal = row[0];
+        row[0] = i;
+        for (size_t j = 1; j <= b.size(); j++) {
+            size_t above = row[j];
+            row[j] = std::min({row[j] + 1, row[j - 1] + 1, diagonal + (a[i - 1] != b[j - 1])});
+            diagonal = above;
+        }
+    }
+    return row[b.size()];
+}
+
+void testTrieFuzzySearch() {
+    Trie trie;
+    for (const char* word : {"nike", "nikon", "adidas", "puma", "pumas", "bike", "nice"}) {
+        trie.insert(word);
+    }
+    
+    auto matches = trie.fuzzySearch("nkie", 2);
+    assert(matches.size() == 2);
+    assert(matches[0].word == "nice" && matches[0].distance == 2);
+    assert(matches[1].word == "nike" && matches[1].distance == 2);
+    
+    matches = trie.fuzzySearch("pumaa", 1);
+    assert(matches.size() == 2);
+    assert(matches[0].word == "puma" && matches[0].distance == 1);
+    assert(matches[1].word == "pumas" && matches[1].distance == 1);
+    
+    assert(trie.fuzzySearch("adidas", 0).size() == 1);
+    assert(trie.fuzzySearch("reebok", 2).empty());
+    assert(trie.fuzzySearch("", 4).size() == 4);  // Every word of length <= 4
+    
+    // An unbounded edit budget matches every word instead of overflowing
+    assert(trie.fuzzySearch("nkie", SIZE_MAX).size() == 7);
+    assert(trie.fuzzySearch("", SIZE_MAX).size() == 7);
+    assert(trie.fuzzySearch("a much longer query than any key", SIZE_MAX - 1).size() == 7);
+    matches = trie.fuzzySearch("nike", SIZE_MAX);
+    assert(matches[0].word == "nike" && matches[0].distance == 0);
+    assert(Trie().fuzzySearch("nike", SIZE_MAX).empty());
+    
+    std::cout << "✓ Trie fuzzy search test passed" << std::endl;
+}
+
+void testTrieFuzzySearchMatchesLinearScan() {
+    std::mt19937 rng(13);
+    std::uniform_int_distribution<int> letter('a', 'e');
+    std::uniform_int_distribution<int> length(0, 9);
+    auto randomWord = [&] {
+        std::string word;
+        int len = length(rng);
+        for (int j = 0; j < len; j++) word.push_back(static_cast<char>(letter(rng)));
+        return word;
+    };
+    
+    Trie trie;
+    std::vector<std::string> words;
+    for (int i = 0; i < 2000; i++) {
+        std::string word = randomWord();
+        if (word.empty() || trie.search(word)) continue;
+        trie.insert(word);
+        words.push_back(word);
+    }
+    
+    for (int q = 0; q < 100; q++) {
+        std::string query = randomWord();
+        for (size_t maxEdits : {0, 1, 2, 3}) {
+            std::vector<std::pair<size_t, std::string>> expected;
+            for (const auto& word : words) {
+                size_t distance = editDistance(query, word);
+                if (distance <= maxEdits) expected.emplace_back(distance, word);
+            }
+            std::sort(expected.begin(), expected.end());
+            
+            auto matches = trie.fuzzySearch(query, maxEdits);
+            assert(matches.size() == expected.size());
+            for (size_t i = 0; i < matches.size(); i++) {
+                assert(matches[i].distance == expected[i].first);
+                assert(matches[i].word == expected[i].second);
+            }
+        }
+    }
+    
+    std::cout << "✓ Trie fuzzy search matches linear scan test passed" << std::endl;
+}
+
 int main() {
     std::cout << "Running Trie tests..." << std::endl;
     
@@ -70,6 +329,15 @@ int main() {
     testTriePrefix();
     testTrieAutoComplete();
     testTrieSize();
+    testTrieClearAndReuse();
+    testTrieWideFanOut();
+    testTrieLongKey();
+    testTrieMemoryResource();
+    testTrieTopK();
+    testTrieCompletionsMatchSort();
+    testTrieWordsWithPrefixSorted();
+    testTrieFuzzySearch();
+    testTrieFuzzySearchMatchesLinearScan();
     
     std::cout << "\n✅ All Trie tests passed!" << std::endl;
     return 0;